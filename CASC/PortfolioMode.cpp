@@ -30,6 +30,7 @@
 #include "Shell/UIHelper.hpp"
 #include "Shell/Normalisation.hpp"
 #include "Shell/Shuffling.hpp"
+#include "Shell/SineUtils.hpp"
 #include "Shell/TheoryFinder.hpp"
 
 #include <limits>
@@ -286,6 +287,28 @@ bool PortfolioMode::prepareScheduleAndPerform(const Shell::Property& prop)
     USER_ERROR("The schedule is empty.");
   }
 
+  auto selectsBySine = [](const std::string& s) {
+    // as in runSlice, the slice's options go on top of ours
+    Options opt;
+    opt.copyValuesFrom(*env.options);
+    try {
+      opt.readFromEncodedOptions(s);
+    } catch (UserErrorException&) {
+      return false; // reported when the slice gets to run
+    }
+    return opt.sineSelection() != Options::SineSelection::OFF;
+  };
+  if (env.options->sineSharedIndex() && iterTraits(schedule.iterFifo()).any(selectsBySine)) {
+    TIME_TRACE(TimeTrace::SINE_SELECTION);
+    if (!_prb->sineIndex()) { // (in the server mode, we inherit one for the axiom base)
+      _sineIndex = new SineIndex();
+      _prb->setSineIndex(_sineIndex.ptr());
+    }
+    // done once here, each child then only syncs it with its preprocessed units
+    _prb->sineIndex()->sync(_prb->units());
+    _prb->sineIndex()->sortAll();
+  }
+
   return runScheduleAndRecoverProof(std::move(schedule));
 };
 
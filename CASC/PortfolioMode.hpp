@@ -67,6 +67,8 @@ private:
    * will be using the problem object.
    */
   ScopedPtr<Problem> _prb;
+  /** SInE index shared by the slices, if some of them select by SInE */
+  ScopedPtr<SineIndex> _sineIndex;
   float _slowness;
 };
 
@@ -17,6 +17,9 @@
  */
 
 #include <cmath>
+#include <cerrno>
+#include <csignal>
+#include <sys/mman.h>
 
 #include "Debug/Tracer.hpp"
 
@@ -31,10 +34,14 @@
 #include "Kernel/Renaming.hpp"
 #include "Kernel/Substitution.hpp"
 #include "Kernel/FormulaUnit.hpp"
+#include "Kernel/MLVariant.hpp"
+#include "Kernel/TermIterators.hpp"
+#include "Kernel/TermTransformer.hpp"
 
 #include "SAT/CadicalInterfacing.hpp"
 #include "SAT/MinisatInterfacingNewSimp.hpp"
 #include "SAT/BufferedSolver.hpp"
+#include "SAT/SATCallMonitoring.hpp"
 
 #include "Lib/Environment.hpp"
 #include "Lib/Timer.hpp"
@@ -42,8 +49,10 @@
 #include "Lib/Stack.hpp"
 #include "Lib/System.hpp"
 #include "Lib/Random.hpp"
+#include "Lib/Sys/Multiprocessing.hpp"
 #include "Lib/DHSet.hpp"
 #include "Lib/ArrayMap.hpp"
+#include "Lib/Hash.hpp"
 
 #include "Shell/UIHelper.hpp"
 #include "Shell/TPTPPrinter.hpp"
@@ -76,7 +85,8 @@ using namespace std;
 
 FiniteModelBuilder::FiniteModelBuilder(Problem& prb, const Options& opt)
 : MainLoop(prb, opt), _sortedSignature(0), _groundClauses(0), _clauses(0),
-                      _isAppropriate(true)
+                      _isAppropriate(true), _workers(opt.fmbWorkers()), _workerIndex(UINT_MAX), _workerExhausted(false),
+                      _shared(0), _sharedWords(0), _sharedNogoodsSeen(0), _modelFile(0)
 
 {
   Property& prop = *prb.getProperty();
@@ -116,6 +126,10 @@ FiniteModelBuilder::FiniteModelBuilder(Problem& prb, const Options& opt)
   // Record option values
   _startModelSize = opt.fmbStartSize();
   _symmetryRatio = opt.fmbSymmetryRatio();
+  _detectSymmetries = opt.fmbSymmetryDetection();
+  _pruneInstances = opt.fmbPruneInstances();
+  _clausesFlushed = 0;
+  _incremental = false;
 
   switch(opt.fmbEnumerationStrategy()) {
     case Options::FMBEnumerationStrategy::SBMEAM:
@@ -132,6 +146,8 @@ FiniteModelBuilder::FiniteModelBuilder(Problem& prb, const Options& opt)
       _dsaEnumerator = 0;
       _xmass = true;
       _sizeWeightRatio = opt.fmbSizeWeightRatio();
+      // minisat's simplification may eliminate variables which later clauses need
+      _incremental = opt.fmbIncremental() && opt.satSolver() == Options::SatSolver::CADICAL;
       break;
     default:
       ASSERTION_VIOLATION;
@@ -143,12 +159,19 @@ FiniteModelBuilder::~FiniteModelBuilder()
   if(_dsaEnumerator){
     delete _dsaEnumerator;
   }
+  if(_shared){
+    munmap(_shared,_sharedWords*sizeof(std::atomic<unsigned>));
+  }
+  if(_modelFile){
+    fclose(_modelFile);
+  }
 }
 
-// Do all setting up required for finite model search 
-// Returns false we if we failed to reset, this can happen if offsets overflow 2^32, possible for
-// large signatures and large models. If this a frequent problem then we can go to longs.
-bool FiniteModelBuilder::reset(){
+// Compute the offsets of the SAT variables for symbols and markers, numbering
+// the groundings as if each distinct sort had its size in _distinctSortCapacities.
+// Returns false if the offsets overflow.
+bool FiniteModelBuilder::computeOffsets(unsigned& offsets)
+{
   // Construct the offsets for symbols
   // Each symbol requires size^n) variables where n is the number of spaces for grounding
   // For function symbols we have n=arity+1 as we have the return value
@@ -160,8 +183,13 @@ bool FiniteModelBuilder::reset(){
 
   static const unsigned VAR_MAX = MinisatInterfacingNewSimp::VAR_MAX;
 
+  _sortCapacities.ensure(_sortedSignature->sorts);
+  for(unsigned s=0;s<_sortedSignature->sorts;s++) {
+    _sortCapacities[s] = _distinctSortCapacities[_sortedSignature->parents[s]];
+  }
+
   // Start from 1 as SAT solver variables are 1-based
-  unsigned offsets=1;
+  offsets=1;
   for(unsigned f=0; f<env.signature->functions();f++){
     if(del_f[f]) continue;
     f_offsets[f]=offsets;
@@ -172,9 +200,9 @@ bool FiniteModelBuilder::reset(){
     auto const& f_signature = _sortedSignature->functionSignatures[f];
     ASS(f_signature.size() == env.signature->functionArity(f)+1);
 
-    unsigned add = _sortModelSizes[f_signature[0]];
+    unsigned add = _sortCapacities[f_signature[0]];
     for(unsigned i=1;i<f_signature.size();i++){
-      unsigned n_add = add * _sortModelSizes[f_signature[i]];
+      unsigned n_add = add * _sortCapacities[f_signature[i]];
       if (n_add < add) { // additional overflow check - we multiply by positive integers!
         return false;
       }
@@ -200,7 +228,7 @@ bool FiniteModelBuilder::reset(){
     ASS(p_signature.size()==env.signature->predicateArity(p));
     unsigned add=1;
     for(unsigned i=0;i<p_signature.size();i++){
-      unsigned n_add = add * _sortModelSizes[p_signature[i]];
+      unsigned n_add = add * _sortCapacities[p_signature[i]];
       if (n_add < add) { // additional overflow check - we multiply by positive integers!
         return false;
       }
@@ -221,7 +249,7 @@ bool FiniteModelBuilder::reset(){
   if (_xmass) {
     marker_offsets.ensure(_distinctSortSizes.size());
     for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
-      unsigned add = _distinctSortSizes[i];
+      unsigned add = _distinctSortCapacities[i];
 
       marker_offsets[i] = offsets;
 
@@ -254,6 +282,53 @@ bool FiniteModelBuilder::reset(){
     offsets += add;
   }
 
+  return true;
+}
+
+// Do all setting up required for finite model search 
+// Returns false we if we failed to reset, this can happen if offsets overflow 2^32, possible for
+// large signatures and large models. If this a frequent problem then we can go to longs.
+bool FiniteModelBuilder::reset(){
+  if (_incremental && hasEncoding()) {
+    bool fits = true;
+    for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
+      if (_distinctSortSizes[i] > _distinctSortCapacities[i]) {
+        fits = false;
+      }
+    }
+    if (fits) {
+      // keep the solver and the variable numbering, the constraints
+      // for the new sizes will be added on top of the old ones
+      createSymmetryOrdering();
+      return true;
+    }
+  }
+
+  _encodedSortSizes.init(_distinctSortSizes.size(),0);
+
+  _distinctSortCapacities.ensure(_distinctSortSizes.size());
+  for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
+    _distinctSortCapacities[i] = _distinctSortSizes[i];
+    if (_incremental) {
+      // leave room to grow without renumbering the variables
+      _distinctSortCapacities[i] = min(2*_distinctSortSizes[i],max(_distinctSortMaxs[i],_distinctSortSizes[i]));
+    }
+  }
+
+  unsigned offsets;
+  if (!computeOffsets(offsets)) {
+    if (!_incremental) {
+      return false;
+    }
+    // try again without the spare room
+    for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
+      _distinctSortCapacities[i] = _distinctSortSizes[i];
+    }
+    if (!computeOffsets(offsets)) {
+      return false;
+    }
+  }
+
   // Create a new SAT solver
   if (env.options->satSolver() == Options::SatSolver::MINISAT)
     try {
@@ -267,6 +342,10 @@ bool FiniteModelBuilder::reset(){
     USER_ERROR("Finite model builder can only use minisat or cadical as SAT solvers.");
   }
 
+  // the facts were about the old solver
+  _knownLiterals.reset();
+  _knownValues.reset();
+
   // set the number of SAT variables, this could cause an exception
   _curMaxVar = offsets-1;
   _solver->ensureVarCount(_curMaxVar);
@@ -298,6 +377,14 @@ void FiniteModelBuilder::createSymmetryOrdering()
   for(unsigned s=0;s<_sortedSignature->sorts;s++){
     unsigned size = _sortModelSizes[s];
 
+    // The solver may already contain symmetry axioms over the previous ordering,
+    // the new one can only be used if it extends the previous one
+    static Stack<GroundedTerm> previous;
+    previous.reset();
+    if (hasEncoding()) {
+      previous.loadFromIterator(Stack<GroundedTerm>::Iterator(_sortedGroundedTerms[s]));
+    }
+
     // Remove any previously computed ordering
     _sortedGroundedTerms[s].reset();
 
@@ -390,6 +477,275 @@ void FiniteModelBuilder::createSymmetryOrdering()
     }
     }
 
+    if (hasEncoding()) {
+      bool extends = previous.size() <= _sortedGroundedTerms[s].size();
+      for (unsigned i = 0; extends && i < previous.size(); i++) {
+        const GroundedTerm& p = previous[i];
+        const GroundedTerm& n = _sortedGroundedTerms[s][i];
+        extends = p.f == n.f && p.grounding.size() == n.grounding.size();
+        for (unsigned j = 0; extends && j < p.grounding.size(); j++) {
+          extends = p.grounding[j] == n.grounding[j];
+        }
+      }
+      if (!extends) {
+        _sortedGroundedTerms[s].reset();
+        _sortedGroundedTerms[s].loadFromIterator(Stack<GroundedTerm>::Iterator(previous));
+      }
+    }
+  }
+}
+
+namespace {
+
+// Swaps two constants in the terms it transforms
+class ConstantSwapper : public TermTransformer
+{
+public:
+  ConstantSwapper(unsigned c1, unsigned c2) : _c1(c1), _c2(c2) {}
+protected:
+  TermList transformSubterm(TermList trm) override
+  {
+    if(trm.isTerm() && !trm.term()->isSort() && trm.term()->arity()==0){
+      unsigned f = trm.term()->functor();
+      if(f==_c1) return TermList(Term::createConstant(_c2));
+      if(f==_c2) return TermList(Term::createConstant(_c1));
+    }
+    return trm;
+  }
+private:
+  unsigned _c1;
+  unsigned _c2;
+};
+
+// A hash of the literal which does not depend on the names of the variables,
+// the constants marked in colour are represented by their colour rather than their name
+unsigned literalShape(Literal* l, const DArray<unsigned>* colour)
+{
+  unsigned h = l->header();
+  SubtermIterator sit(l);
+  while(sit.hasNext()){
+    TermList t = sit.next();
+    unsigned f = 0;
+    if(t.isTerm()){
+      f = t.term()->functor()+1;
+      if(colour && !t.term()->isSort() && t.term()->arity()==0 && (*colour)[f-1]){
+        f = (*colour)[f-1];
+      }
+    }
+    h = HashUtils::combine(h,f);
+  }
+  return h;
+}
+
+template<class LitArray>
+unsigned clauseShape(const LitArray& lits, unsigned len, const DArray<unsigned>* colour)
+{
+  static Stack<unsigned> shapes;
+  shapes.reset();
+  for(unsigned i=0;i<len;i++){
+    shapes.push(literalShape(lits[i],colour));
+  }
+  std::sort(shapes.begin(),shapes.end());
+  unsigned h = len;
+  for(unsigned i=0;i<shapes.size();i++){
+    h = HashUtils::combine(h,shapes[i]);
+  }
+  return h;
+}
+
+}
+
+/**
+ * A light-weight form of symmetry detection: two constants of the same sort are interchangeable
+ * if swapping them maps the (flattened) clauses to themselves. Candidates are found by partition
+ * refinement (a constant is coloured by the colours of the clauses it occurs in and a clause by the
+ * colours of its constants, until the partition stops splitting); a class is then confirmed by
+ * checking the transpositions of its first member with the others, which generate all permutations.
+ *
+ * Within the order of constants used by the symmetry ordering axioms each class is made contiguous,
+ * so that the values of its members can be ordered on top of the least number heuristic.
+ */
+void FiniteModelBuilder::detectSymmetricConstants()
+{
+  _symmetricConstants.ensure(_sortedSignature->sorts);
+  if(!_detectSymmetries) return;
+
+  TIME_TRACE("fmb symmetry detection");
+
+  unsigned funs = env.signature->functions();
+  // zero for the symbols which are not candidates
+  DArray<unsigned> colour;
+  colour.init(funs,0);
+  for(unsigned s=0;s<_sortedSignature->sorts;s++){
+    Stack<unsigned>::Iterator cit(_sortedSignature->sortedConstants[s]);
+    while(cit.hasNext()){
+      unsigned c = cit.next();
+      if(c<del_f.size() && del_f[c]) continue;
+      colour[c] = HashUtils::combine(s,1);
+    }
+  }
+
+  // the clauses with some candidate in them and the candidates' occurrences
+  Stack<Clause*> relevant;
+  DArray<Stack<unsigned>> occurrences(funs);
+  ClauseList::Iterator it(_clauses);
+  while(it.hasNext()){
+    Clause* c = it.next();
+    bool isRelevant = false;
+    for(unsigned i=0;i<c->length();i++){
+      SubtermIterator sit((*c)[i]);
+      while(sit.hasNext()){
+        TermList t = sit.next();
+        if(t.isTerm() && !t.term()->isSort() && t.term()->arity()==0 && colour[t.term()->functor()]){
+          occurrences[t.term()->functor()].push(relevant.size());
+          isRelevant = true;
+        }
+      }
+    }
+    if(isRelevant){
+      relevant.push(c);
+    }
+  }
+
+  // refine until the number of classes does not grow anymore
+  DArray<unsigned> clauseColour(relevant.size());
+  DArray<unsigned> newColour(funs);
+  unsigned classes = 0;
+  while(true){
+    for(unsigned i=0;i<relevant.size();i++){
+      clauseColour[i] = clauseShape(relevant[i]->literals(),relevant[i]->length(),&colour);
+    }
+    DHSet<unsigned> distinct;
+    for(unsigned f=0;f<funs;f++){
+      newColour[f] = 0;
+      if(!colour[f]) continue;
+      static Stack<unsigned> seen;
+      seen.reset();
+      Stack<unsigned>::Iterator oit(occurrences[f]);
+      while(oit.hasNext()){
+        seen.push(clauseColour[oit.next()]);
+      }
+      std::sort(seen.begin(),seen.end());
+      unsigned h = colour[f];
+      for(unsigned i=0;i<seen.size();i++){
+        h = HashUtils::combine(h,seen[i]);
+      }
+      // zero is reserved for non-candidates
+      newColour[f] = h ? h : 1;
+      distinct.insert(newColour[f]);
+    }
+    if(distinct.size() <= classes) break;
+    classes = distinct.size();
+    for(unsigned f=0;f<funs;f++){
+      colour[f] = newColour[f];
+    }
+  }
+
+  // index the relevant clauses by their shape to look up the swapped ones
+  DHMap<unsigned,ClauseList*> byShape;
+  for(unsigned i=0;i<relevant.size();i++){
+    ClauseList** bucket;
+    byShape.getValuePtr(clauseShape(relevant[i]->literals(),relevant[i]->length(),nullptr),bucket,nullptr);
+    ClauseList::push(relevant[i],*bucket);
+  }
+
+  auto isSymmetry = [&](unsigned c1, unsigned c2) {
+    ConstantSwapper swapper(c1,c2);
+    static LiteralStack swapped;
+    for(unsigned k=0;k<2;k++){
+      Stack<unsigned>::Iterator oit(occurrences[k ? c2 : c1]);
+      while(oit.hasNext()){
+        Clause* c = relevant[oit.next()];
+        swapped.reset();
+        for(unsigned i=0;i<c->length();i++){
+          swapped.push(swapper.transformLiteral((*c)[i]));
+        }
+        ClauseList* candidates = 0;
+        byShape.find(clauseShape(swapped,swapped.size(),nullptr),candidates);
+        bool found = false;
+        while(candidates && !found){
+          Clause* d = candidates->head();
+          found = d->length()==swapped.size() && MLVariant::isVariant(swapped.begin(),d);
+          candidates = candidates->tail();
+        }
+        if(!found){
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  for(unsigned s=0;s<_sortedSignature->sorts;s++){
+    Stack<unsigned>& constants = _sortedSignature->sortedConstants[s];
+    Stack<unsigned> reordered;
+    DHSet<unsigned> placed;
+    for(unsigned i=0;i<constants.size();i++){
+      unsigned rep = constants[i];
+      if(placed.contains(rep)) continue;
+      placed.insert(rep);
+      unsigned first = reordered.size();
+      reordered.push(rep);
+      if(!colour[rep]) continue;
+      for(unsigned j=i+1;j<constants.size();j++){
+        unsigned c = constants[j];
+        if(placed.contains(c) || colour[c]!=colour[rep] || !isSymmetry(rep,c)) continue;
+        placed.insert(c);
+        reordered.push(c);
+      }
+      unsigned length = reordered.size()-first;
+      if(length>1){
+        _symmetricConstants[s].push(make_pair(first,length));
+        env.statistics->fmbSymmetricConstants += length;
+#if VTRACE_FMB
+        cout << "Interchangeable constants in sort " << s << ":";
+        for(unsigned k=first;k<reordered.size();k++){
+          cout << " " << env.signature->functionName(reordered[k]);
+        }
+        cout << endl;
+#endif
+      }
+    }
+    constants = reordered;
+  }
+
+  DHMap<unsigned,ClauseList*>::Iterator bit(byShape);
+  while(bit.hasNext()){
+    ClauseList::destroy(bit.next());
+  }
+}
+
+void FiniteModelBuilder::addNewSymmetricConstantAxioms()
+{
+  static DArray<unsigned> grounding(1);
+
+  for(unsigned s=0;s<_sortedSignature->sorts;s++){
+    unsigned size = _sortModelSizes[s];
+    // the pairs of values both at most the encoded size are already in the solver
+    unsigned encoded = _encodedSortSizes[_sortedSignature->parents[s]];
+    Stack<unsigned>& constants = _sortedSignature->sortedConstants[s];
+
+    Stack<std::pair<unsigned,unsigned>>::Iterator cit(_symmetricConstants[s]);
+    while(cit.hasNext()){
+      std::pair<unsigned,unsigned> cls = cit.next();
+      for(unsigned i=cls.first;i+1<cls.first+cls.second;i++){
+        unsigned smaller = constants[i];
+        unsigned bigger = constants[i+1];
+        // bigger=v implies smaller<=v
+        for(unsigned v=1;v<size;v++){
+          for(unsigned w=max(v+1,encoded+1);w<=size;w++){
+            static SATLiteralStack satClauseLits;
+            satClauseLits.reset();
+            grounding[0]=v;
+            satClauseLits.push(getSATLiteral(bigger,grounding,false,true));
+            grounding[0]=w;
+            satClauseLits.push(getSATLiteral(smaller,grounding,false,true));
+            addSATClause(satClauseLits);
+            env.statistics->fmbSymmetryBreakingClauses++;
+          }
+        }
+      }
+    }
   }
 }
 
@@ -753,6 +1109,8 @@ void FiniteModelBuilder::init()
     }
   }
 
+  detectSymmetricConstants();
+
 #if VTRACE_FMB
   cout << "Now Find Minimum Sort Bounds" << endl;
 #endif
@@ -927,6 +1285,8 @@ void FiniteModelBuilder::addGroundClauses()
 {
   // If we don't have any ground clauses don't do anything
   if(!_groundClauses) return;
+  // They don't depend on the sizes, so they are in the solver already
+  if(hasEncoding()) return;
 
   ClauseList::Iterator cit(_groundClauses);
 
@@ -948,8 +1308,7 @@ void FiniteModelBuilder::addGroundClauses()
         SATLiteral slit = getSATLiteral(f,emptyGrounding,(*c)[i]->polarity(),false);
         satClauseLits.push(slit);
       }
-      SATClause* satCl = SATClause::fromStack(satClauseLits);
-      addSATClause(satCl);
+      addSATClause(satClauseLits);
   }
 }
 
@@ -1042,6 +1401,17 @@ instanceLabel:
       else{
         grounding[var]++;
         // Grounding represents a new instance
+
+        if (hasEncoding()) {
+          bool isEncoded = true;
+          for(unsigned v=0;v<vars && isEncoded;v++) {
+            isEncoded = encoded((*varSorts)[v],grounding[v]);
+          }
+          if (isEncoded) {
+            goto instanceLabel;
+          }
+        }
+
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
 
@@ -1087,6 +1457,10 @@ instanceLabel:
           }
         }
 
+        // a literal left out because the facts falsify it
+        SATLiteral falsified = SATLiteral::dummy();
+        unsigned markers = satClauseLits.size();
+
         // Ground and translate each literal into a SATLiteral
         for(unsigned lindex=0;lindex<c->length();lindex++){
           Literal* lit = (*c)[lindex];
@@ -1117,6 +1491,15 @@ instanceLabel:
               use[j] = grounding[t->nthArgument(j)->var()];
             }
             use[arity]=grounding[lit->nthArgument(1)->var()];
+            bool value;
+            if(_pruneInstances && isKnown(functor,use,true,value)){
+              if(value==lit->polarity()){
+                // satisfied, skip instance
+                goto instanceLabel;
+              }
+              falsified = getSATLiteral(functor,use,lit->polarity(),true);
+              continue;
+            }
             satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),true));
             
           }else{
@@ -1129,12 +1512,24 @@ instanceLabel:
               ASS(lit->nthArgument(j)->isVar());
               use[j] = grounding[lit->nthArgument(j)->var()];
             }
+            bool value;
+            if(_pruneInstances && isKnown(functor,use,false,value)){
+              if(value==lit->polarity()){
+                // satisfied, skip instance
+                goto instanceLabel;
+              }
+              falsified = getSATLiteral(functor,use,lit->polarity(),false);
+              continue;
+            }
             satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),false));
           }
         }
+        if(satClauseLits.size()==markers && falsified!=SATLiteral::dummy()){
+          // keep one, the solver should see the conflict rather than an empty clause
+          satClauseLits.push(falsified);
+        }
      
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+        addSATClause(satClauseLits);
 
         goto instanceLabel;
       }
@@ -1221,6 +1616,15 @@ newFuncLabel:
             //Skip this instance
             goto newFuncLabel;
           }
+          if(hasEncoding() && encoded(returnSrt,grounding[0]) && encoded(returnSrt,grounding[1])){
+            bool isEncoded = true;
+            for(unsigned v=2;v<arity+2 && isEncoded;v++){
+              isEncoded = encoded(f_signature[v-2],grounding[v]);
+            }
+            if(isEncoded){
+              goto newFuncLabel;
+            }
+          }
           static SATLiteralStack satClauseLits;
           satClauseLits.reset();
 
@@ -1236,8 +1640,7 @@ newFuncLabel:
           use[arity]=grounding[1];
           satClauseLits.push(getSATLiteral(f,use,false,true));
 
-          SATClause* satCl = SATClause::fromStack(satClauseLits);
-          addSATClause(satCl);
+          addSATClause(satClauseLits);
           goto newFuncLabel;
         }
       }
@@ -1267,9 +1670,12 @@ void FiniteModelBuilder::addNewSymmetryOrderingAxioms(unsigned size,
     SATLiteral sl = getSATLiteral(gt.f,grounding,true,true);
     satClauseLits.push(sl);
   }
-  SATClause* satCl = SATClause::fromStack(satClauseLits);
-  addSATClause(satCl);
+  addSATClause(satClauseLits);
 
+  if(_pruneInstances && size==1){
+    // the first term is 1, so it is nothing else (functionality)
+    _knownValues.insert(satClauseLits[0].var(),1);
+  }
 }
 
 void FiniteModelBuilder::addNewSymmetryCanonicityAxioms(unsigned size,
@@ -1310,7 +1716,7 @@ void FiniteModelBuilder::addNewSymmetryCanonicityAxioms(unsigned size,
 
         satClauseLits.push(getSATLiteral(gtj.f,grounding_j,true,true));
       }
-      addSATClause(SATClause::fromStack(satClauseLits));
+      addSATClause(satClauseLits);
   }
 
 }
@@ -1348,7 +1754,7 @@ void FiniteModelBuilder::addUseModelSize(unsigned size)
     }
   }
 
-  addSATClause(SATClause::fromStack(satClauseLits));
+  addSATClause(satClauseLits);
 */
 }
 
@@ -1358,15 +1764,15 @@ void FiniteModelBuilder::addNewTotalityDefs()
     // make sure to solve the problem of some sorts not growing all the way to _sortModelSizes[srt], because of _sortedSignature->sortBounds[srt]
     for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
       // for every sort
-      for (unsigned j = 0; j < _distinctSortSizes[i]-1; j++) {
+      unsigned from = _encodedSortSizes[i] ? _encodedSortSizes[i]-1 : 0;
+      for (unsigned j = from; j+1 < _distinctSortSizes[i]; j++) {
         // for every domain size j have clause: not marker(j+1) | marker(j)
         // which says: "d > j+2" -> "d > j+1"
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
         satClauseLits.push(SATLiteral(marker_offsets[i]+j,1));
         satClauseLits.push(SATLiteral(marker_offsets[i]+j+1,0));
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+        addSATClause(satClauseLits);
       }
     }
   }
@@ -1388,7 +1794,12 @@ void FiniteModelBuilder::addNewTotalityDefs()
 
       // cout << "Totality for const " << f << " of sort " << srt << " and max size " << maxSize << endl;
 
-      for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dsrt])) ? maxSize : 1; i <= maxSize; i++) { // just the weakest one, if monotonic
+      unsigned firstVersion = (!_xmass || (_sortedSignature->monotonicSorts[dsrt])) ? maxSize : 1; // just the weakest one, if monotonic
+      if (hasEncoding()) {
+        // the smaller versions are in the solver already
+        firstVersion = max(firstVersion,min(_sortedSignature->sortBounds[srt],_encodedSortSizes[dsrt]));
+      }
+      for (unsigned i = firstVersion; i <= maxSize; i++) {
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
 
@@ -1407,8 +1818,7 @@ void FiniteModelBuilder::addNewTotalityDefs()
           satClauseLits.push(SATLiteral(totalityMarker_offset+dsrt,0));
         }
 
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+        addSATClause(satClauseLits);
       }
 
       continue;
@@ -1441,7 +1851,18 @@ newTotalLabel:
           //for(unsigned j=0;j<grounding.size();j++) cout << grounding[j] << " ";
           //cout << endl;
 
-          for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dRetSrt])) ? maxRtSrtSize : 1; i <= maxRtSrtSize; i++) {
+          unsigned firstVersion = (!_xmass || (_sortedSignature->monotonicSorts[dRetSrt])) ? maxRtSrtSize : 1;
+          if (hasEncoding()) {
+            bool isEncoded = true;
+            for(unsigned v=0;v<arity && isEncoded;v++){
+              isEncoded = encoded(f_signature[v],grounding[v]);
+            }
+            if (isEncoded) {
+              // the smaller versions are in the solver already
+              firstVersion = max(firstVersion,min(_sortedSignature->sortBounds[retSrt],_encodedSortSizes[dRetSrt]));
+            }
+          }
+          for (unsigned i = firstVersion; i <= maxRtSrtSize; i++) {
             static SATLiteralStack satClauseLits;
             satClauseLits.reset();
 
@@ -1458,8 +1879,7 @@ newTotalLabel:
             } else {
               satClauseLits.push(SATLiteral(totalityMarker_offset+dRetSrt,0));
             }
-            SATClause* satCl = SATClause::fromStack(satClauseLits);
-            addSATClause(satCl);
+            addSATClause(satClauseLits);
           }
           goto newTotalLabel;
         }
@@ -1499,27 +1919,337 @@ SATLiteral FiniteModelBuilder::getSATLiteral(unsigned f, const DArray<unsigned>&
   for(unsigned i=0;i<grounding.size();i++){
     var += mult*(grounding[i]-1);
     unsigned srt = signature[i];
-    //cout << var << ", " << mult << "," << _sortModelSizes[srt] << endl;
-    mult *= _sortModelSizes[srt];
+    //cout << var << ", " << mult << "," << _sortCapacities[srt] << endl;
+    mult *= _sortCapacities[srt];
   }
   //cout << "return " << var << endl;
 
   return SATLiteral(var,polarity);
 }
 
-void FiniteModelBuilder::addSATClause(SATClause* cl)
+// Generated clauses are passed to the solver in chunks of this many, rather than all at once
+static const unsigned SAT_CLAUSE_CHUNK = 1u << 16;
+
+void FiniteModelBuilder::addSATClause(SATLiteralStack& lits)
 {
-  cl = SATClause::removeDuplicateLiterals(cl);
-  if(!cl){ return; }
+  // drops tautologies
+  if(!_clausesToBeAdded.add(lits)){ return; }
+  unsigned added = _clausesToBeAdded.size()-1;
 #if VTRACE_FMB
-  cout << "ADDING " << cl->toString() << endl; // " of size " << cl->length() << endl;
+  cout << "ADDING";
+  for(unsigned i=0;i<_clausesToBeAdded.length(added);i++){
+    cout << " " << _clausesToBeAdded.literals(added)[i];
+  }
+  cout << endl;
 #endif
 
-  _clausesToBeAdded.push(cl);
+  if(_pruneInstances && _clausesToBeAdded.length(added)==1){
+    SATLiteral unit = _clausesToBeAdded.literals(added)[0];
+    _knownLiterals.insert(unit.var(),unit.isPositive());
+  }
+
+  if(_clausesToBeAdded.size() >= SAT_CLAUSE_CHUNK){
+    flushSATClauses();
+  }
+}
 
+void FiniteModelBuilder::flushSATClauses()
+{
+  if (_opt.randomTraversals()) {
+    TIME_TRACE(TimeTrace::SHUFFLING);
+    _clausesToBeAdded.shuffle();
+  }
+  _solver->addClauses(_clausesToBeAdded);
+  _clausesFlushed += _clausesToBeAdded.size();
+  _clausesToBeAdded.reset();
+}
+
+bool FiniteModelBuilder::isKnown(unsigned func, DArray<unsigned>& elements, bool isFunction, bool& value)
+{
+  if(_knownLiterals.find(getSATLiteral(func,elements,true,isFunction).var(),value)){
+    return true;
+  }
+  if(!isFunction || _knownValues.isEmpty()){
+    return false;
+  }
+  unsigned last = elements.size()-1;
+  unsigned element = elements[last];
+  elements[last] = 1;
+  unsigned known;
+  bool res = _knownValues.find(getSATLiteral(func,elements,true,true).var(),known);
+  elements[last] = element;
+  if(res){
+    value = known==element;
+  }
+  return res;
+}
+
+namespace {
+// Layout of the memory shared by the FMB workers (in words):
+// the index of the worker which found a model, the number of published nogoods,
+// for every worker its claim (a sequence number followed by its sort sizes)
+// and finally the nogoods (author+1 or 0 when not yet written, weight and the constraints).
+const unsigned SHARED_WINNER = 0;
+const unsigned SHARED_NOGOOD_CNT = 1;
+const unsigned SHARED_HEADER = 2;
+const unsigned SHARED_NOGOOD_CAPACITY = 4096;
+
+// Exit code of a worker which ran out of size assignments to try
+const int WORKER_EXHAUSTED = 3;
 }
 
 MainLoopResult FiniteModelBuilder::runImpl()
+{
+  MainLoopResult res = searchForModel();
+
+  if (_workerIndex != UINT_MAX) {
+    // a worker only reports back to the parent, which does the final output
+    if (res.terminationReason == Statistics::SATISFIABLE) {
+      const std::string& model = env.statistics->model;
+      if (fwrite(model.data(),1,model.size(),_modelFile) != model.size() || fflush(_modelFile)) {
+        exit(EXIT_FAILURE);
+      }
+      exit(EXIT_SUCCESS);
+    }
+    // the claims of the other workers are learned as nogoods, so only the parent
+    // can tell if running out of size assignments means there is no model
+    exit(_workerExhausted ? WORKER_EXHAUSTED : EXIT_FAILURE);
+  }
+  return res;
+}
+
+bool FiniteModelBuilder::forkWorkers()
+{
+  unsigned sorts = _distinctSortSizes.size();
+
+  _modelFile = tmpfile();
+  if (!_modelFile) {
+    return false;
+  }
+
+  // let every worker start from a different size assignment;
+  // the parent's enumerator gets to produce them, pretending the earlier ones have failed
+  DArray<unsigned> starts(_workers*sorts);
+  Constraint_Generator_Vals pretend(sorts);
+  unsigned workers = 0;
+  while (true) {
+    for (unsigned i=0;i<sorts;i++) {
+      starts[workers*sorts+i] = _distinctSortSizes[i];
+      pretend[i] = make_pair(EQ,_distinctSortSizes[i]);
+    }
+    workers++;
+    if (workers == _workers) {
+      break;
+    }
+    _dsaEnumerator->learnNogood(pretend,0);
+    if (!_dsaEnumerator->increaseModelSizes(_distinctSortSizes,_distinctSortMaxs)) {
+      break;
+    }
+  }
+  if (workers < 2) {
+    return false;
+  }
+  _workers = workers;
+
+  _sharedWords = SHARED_HEADER + _workers*(1+sorts) + SHARED_NOGOOD_CAPACITY*(2+2*sorts);
+  void* mem = mmap(0,_sharedWords*sizeof(std::atomic<unsigned>),PROT_READ|PROT_WRITE,MAP_SHARED|MAP_ANONYMOUS,-1,0);
+  if (mem == MAP_FAILED) {
+    SYSTEM_FAIL("Call to mmap() failed.", errno);
+  }
+  _shared = static_cast<std::atomic<unsigned>*>(mem);
+  for (size_t i=0;i<_sharedWords;i++) {
+    new (&_shared[i]) std::atomic<unsigned>(0);
+  }
+  _shared[SHARED_WINNER] = UINT_MAX;
+  _claimsSeen.init(_workers,0);
+
+  // don't let the workers inherit (and print again) our pending output
+  cout << flush;
+
+  for (unsigned w=0;w<_workers;w++) {
+    pid_t pid = Lib::Sys::Multiprocessing::instance()->fork();
+    if (pid == 0) {
+      System::registerForSIGHUPOnParentDeath();
+      Timer::reinitialise();
+      _workerIndex = w;
+      _workerPids.reset();
+      for (unsigned i=0;i<sorts;i++) {
+        _distinctSortSizes[i] = starts[w*sorts+i];
+      }
+      for (unsigned s=0;s<_sortedSignature->sorts;s++) {
+        _sortModelSizes[s] = _distinctSortSizes[_sortedSignature->parents[s]];
+      }
+      claimSizes();
+      importFromOtherWorkers();
+      return false;
+    }
+    _workerPids.push(pid);
+  }
+  return true;
+}
+
+MainLoopResult FiniteModelBuilder::collectWorkers()
+{
+  bool found = false;
+  unsigned exhausted = 0;
+  while (_workerPids.isNonEmpty() && !found) {
+    bool exited, signalled;
+    int code;
+    pid_t pid = Lib::Sys::Multiprocessing::instance()->poll_children(exited,signalled,code);
+    if (!exited && !signalled) {
+      continue;
+    }
+    for (unsigned i=0;i<_workerPids.size();i++) {
+      if (_workerPids[i] == pid) {
+        _workerPids[i] = _workerPids.top();
+        _workerPids.pop();
+        break;
+      }
+    }
+    found = exited && !code;
+    if (exited && code == WORKER_EXHAUSTED) {
+      exhausted++;
+    }
+  }
+
+  while (_workerPids.isNonEmpty()) {
+    Lib::Sys::Multiprocessing::instance()->killNoCheck(_workerPids.pop(),SIGINT);
+  }
+
+  if (!found) {
+    if (exhausted == _workers && learnWorkerNogoods()) {
+      return MainLoopResult(Statistics::REFUTATION,
+          Clause::empty(NonspecificInferenceMany(InferenceRule::MODEL_NOT_FOUND,_prb.units())));
+    }
+    return MainLoopResult(Statistics::REFUTATION_NOT_FOUND);
+  }
+
+  // the winner has already announced the model (see onModelFound), now take over printing it
+  if (_opt.proof() != Options::Proof::OFF && szsOutputMode()) {
+    UIHelper::satisfiableStatusWasAlreadyOutput = true;
+  }
+  std::string& model = env.statistics->model;
+  model.clear();
+  rewind(_modelFile);
+  char buf[4096];
+  size_t read;
+  while ((read = fread(buf,1,sizeof(buf),_modelFile)) > 0) {
+    model.append(buf,read);
+  }
+  return MainLoopResult(Statistics::SATISFIABLE);
+}
+
+void FiniteModelBuilder::shareNogood(Constraint_Generator_Vals& nogood, unsigned weight)
+{
+  unsigned sorts = _distinctSortSizes.size();
+  unsigned idx = _shared[SHARED_NOGOOD_CNT].fetch_add(1);
+  if (idx >= SHARED_NOGOOD_CAPACITY) {
+    // out of room, the others will have to find this one themselves
+    return;
+  }
+  std::atomic<unsigned>* slot = _shared + SHARED_HEADER + _workers*(1+sorts) + idx*(2+2*sorts);
+  slot[1].store(weight,std::memory_order_relaxed);
+  for (unsigned i=0;i<sorts;i++) {
+    slot[2+2*i].store(nogood[i].first,std::memory_order_relaxed);
+    slot[3+2*i].store(nogood[i].second,std::memory_order_relaxed);
+  }
+  slot[0].store(_workerIndex+1,std::memory_order_release);
+}
+
+/**
+ * Learn the nogoods published by the workers, after all of them ran out of size
+ * assignments to try, and return true if they rule out every assignment.
+ *
+ * The claims the workers learned from each other are not among the published
+ * nogoods, so this only relies on real ones. The start assignments we pretended
+ * to have failed in forkWorkers() are covered by the nogoods their workers found
+ * for them, as long as none of the nogoods was lost for lack of room.
+ */
+bool FiniteModelBuilder::learnWorkerNogoods()
+{
+  unsigned published = _shared[SHARED_NOGOOD_CNT].load();
+  if (published > SHARED_NOGOOD_CAPACITY) {
+    return false;
+  }
+
+  unsigned sorts = _distinctSortSizes.size();
+  Constraint_Generator_Vals nogood(sorts);
+  for (unsigned n=0;n<published;n++) {
+    std::atomic<unsigned>* slot = _shared + SHARED_HEADER + _workers*(1+sorts) + n*(2+2*sorts);
+    // the workers have all exited
+    ASS(slot[0].load(std::memory_order_acquire));
+    for (unsigned i=0;i<sorts;i++) {
+      nogood[i] = make_pair(static_cast<ConstraintSign>(slot[2+2*i].load(std::memory_order_relaxed)),
+                            slot[3+2*i].load(std::memory_order_relaxed));
+    }
+    _dsaEnumerator->learnNogood(nogood,slot[1].load(std::memory_order_relaxed));
+  }
+
+  return !_dsaEnumerator->increaseModelSizes(_distinctSortSizes,_distinctSortMaxs) &&
+    _dsaEnumerator->isFmbComplete(sorts);
+}
+
+void FiniteModelBuilder::importFromOtherWorkers()
+{
+  unsigned sorts = _distinctSortSizes.size();
+  Constraint_Generator_Vals nogood(sorts);
+
+  unsigned published = min(_shared[SHARED_NOGOOD_CNT].load(),SHARED_NOGOOD_CAPACITY);
+  while (_sharedNogoodsSeen < published) {
+    std::atomic<unsigned>* slot = _shared + SHARED_HEADER + _workers*(1+sorts) + _sharedNogoodsSeen*(2+2*sorts);
+    unsigned author = slot[0].load(std::memory_order_acquire);
+    if (!author) {
+      // still being written, pick it up next time
+      break;
+    }
+    _sharedNogoodsSeen++;
+    if (author == _workerIndex+1) {
+      continue;
+    }
+    for (unsigned i=0;i<sorts;i++) {
+      nogood[i] = make_pair(static_cast<ConstraintSign>(slot[2+2*i].load(std::memory_order_relaxed)),
+                            slot[3+2*i].load(std::memory_order_relaxed));
+    }
+    _dsaEnumerator->learnNogood(nogood,slot[1].load(std::memory_order_relaxed));
+  }
+
+  // the size assignments the others are trying now are off-limits for us
+  for (unsigned w=0;w<_workers;w++) {
+    if (w == _workerIndex) {
+      continue;
+    }
+    std::atomic<unsigned>* claim = _shared + SHARED_HEADER + w*(1+sorts);
+    unsigned seq = claim[0].load(std::memory_order_acquire);
+    if (seq == _claimsSeen[w] || (seq & 1)) {
+      continue;
+    }
+    for (unsigned i=0;i<sorts;i++) {
+      nogood[i] = make_pair(EQ,claim[1+i].load(std::memory_order_relaxed));
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (claim[0].load(std::memory_order_relaxed) != seq) {
+      // changed under our hands
+      continue;
+    }
+    _claimsSeen[w] = seq;
+    _dsaEnumerator->learnNogood(nogood,0);
+  }
+}
+
+void FiniteModelBuilder::claimSizes()
+{
+  unsigned sorts = _distinctSortSizes.size();
+  std::atomic<unsigned>* claim = _shared + SHARED_HEADER + _workerIndex*(1+sorts);
+  unsigned seq = claim[0].load(std::memory_order_relaxed);
+  claim[0].store(seq+1,std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (unsigned i=0;i<sorts;i++) {
+    claim[1+i].store(_distinctSortSizes[i],std::memory_order_relaxed);
+  }
+  claim[0].store(seq+2,std::memory_order_release);
+}
+
+MainLoopResult FiniteModelBuilder::searchForModel()
 {
   if(!_isAppropriate){
     // give up!
@@ -1574,6 +2304,9 @@ MainLoopResult FiniteModelBuilder::runImpl()
     if (!_dsaEnumerator->init(_startModelSize,_distinctSortSizes,_distinct_sort_constraints,_strict_distinct_sort_constraints)) {
       goto gave_up;
     }
+    if (_workers > 1 && _distinctSortSizes.size() && forkWorkers()) {
+      return collectWorkers();
+    }
   }
 
   if (reset()) {
@@ -1594,6 +2327,14 @@ MainLoopResult FiniteModelBuilder::runImpl()
     cout << "GROUND" << endl;
 #endif
     addGroundClauses();
+    if (_pruneInstances) {
+      // the instances are pruned with the unit facts of the symmetry axioms
+#if VTRACE_FMB
+      cout << "SYM DEFS" << endl;
+#endif
+      addNewSymmetryAxioms();
+      addNewSymmetricConstantAxioms();
+    }
 #if VTRACE_FMB
     cout << "INSTANCES" << endl;
 #endif
@@ -1602,16 +2343,24 @@ MainLoopResult FiniteModelBuilder::runImpl()
     cout << "FUNC DEFS" << endl;
 #endif
     addNewFunctionalDefs();
+    if (!_pruneInstances) {
 #if VTRACE_FMB
-    cout << "SYM DEFS" << endl;
+      cout << "SYM DEFS" << endl;
 #endif
-    addNewSymmetryAxioms();
+      addNewSymmetryAxioms();
+      addNewSymmetricConstantAxioms();
+    }
     
 #if VTRACE_FMB
     cout << "TOTAL DEFS" << endl;
 #endif
     addNewTotalityDefs();
 
+    if (_incremental) {
+      for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
+        _encodedSortSizes[i] = _distinctSortSizes[i];
+      }
+    }
     }
 
 #if VTRACE_FMB
@@ -1621,13 +2370,9 @@ MainLoopResult FiniteModelBuilder::runImpl()
     // pass clauses and assumption to SAT Solver
     SATSolver::Status satResult = SATSolver::Status::UNKNOWN;
     {
-      if (_opt.randomTraversals()) {
-        TIME_TRACE(TimeTrace::SHUFFLING);
-        Shuffling::shuffleArray(_clausesToBeAdded,_clausesToBeAdded.size());
-      }
       TIME_TRACE("fmb sat solving");
 
-      _solver->addClausesIter(pvi(SATClauseStack::ConstIterator(_clausesToBeAdded)));
+      flushSATClauses();
 
       env.statistics->phase = Statistics::FMB_SOLVING;
 
@@ -1650,7 +2395,8 @@ MainLoopResult FiniteModelBuilder::runImpl()
       if (_opt.randomTraversals()) {
         _solver->randomizeForNextAssignment(_curMaxVar);
       }
-      satResult = _solver->solveUnderAssumptions(assumptions);
+      SATCallRecorder rec(*_solver, env.statistics->fmbSatCalls);
+      satResult = rec.record(_solver->solveUnderAssumptions(assumptions));
       env.statistics->phase = Statistics::FMB_CONSTRAINT_GEN;
     }
 
@@ -1689,20 +2435,20 @@ MainLoopResult FiniteModelBuilder::runImpl()
         */
       }
 
+      if (_workerIndex != UINT_MAX) {
+        unsigned noWinner = UINT_MAX;
+        if (!_shared[SHARED_WINNER].compare_exchange_strong(noWinner,_workerIndex)) {
+          // somebody else got there first
+          return MainLoopResult(Statistics::REFUTATION_NOT_FOUND);
+        }
+      }
       onModelFound();
       return MainLoopResult(Statistics::SATISFIABLE);
     }
 
-    unsigned clauseSetSize = _clausesToBeAdded.size();
+    unsigned clauseSetSize = _clausesFlushed;
     unsigned weight = clauseSetSize;
-
-    // destroy the clauses
-    SATClauseStack::Iterator it(_clausesToBeAdded);
-    while (it.hasNext()) {
-      it.next()->destroy();
-    }
-    // but the container needs to be empty for the next round in any case
-    _clausesToBeAdded.reset();
+    _clausesFlushed = 0;
 
     {
       // _solver->explicitlyMinimizedFailedAssumptions(false,true); // TODO: try adding this in
@@ -1818,8 +2564,17 @@ MainLoopResult FiniteModelBuilder::runImpl()
 #endif
 
         _dsaEnumerator->learnNogood(nogood,weight);
+        if (_workerIndex != UINT_MAX) {
+          shareNogood(nogood,weight);
+          importFromOtherWorkers();
+        }
 
         if (!_dsaEnumerator->increaseModelSizes(_distinctSortSizes,_distinctSortMaxs)) {
+          // a worker has learned the other workers' claims, which are not real nogoods
+          if (_workerIndex != UINT_MAX) {
+            _workerExhausted = true;
+            goto gave_up;
+          }
           if (_dsaEnumerator->isFmbComplete(_distinctSortSizes.size())) {
             return MainLoopResult(Statistics::REFUTATION,
                 Clause::empty(NonspecificInferenceMany(InferenceRule::MODEL_NOT_FOUND,_prb.units())));
@@ -1831,6 +2586,10 @@ MainLoopResult FiniteModelBuilder::runImpl()
           }
         }
 
+        if (_workerIndex != UINT_MAX) {
+          claimSizes();
+        }
+
         for(unsigned s=0;s<_sortedSignature->sorts;s++) {
           _sortModelSizes[s] = _distinctSortSizes[_sortedSignature->parents[s]];
         }
@@ -15,6 +15,10 @@
 #ifndef __FiniteModelBuilder__
 #define __FiniteModelBuilder__
 
+#include <atomic>
+#include <cstdio>
+#include <sys/types.h>
+
 #include "Forwards.hpp"
 
 #if VZ3
@@ -69,6 +73,9 @@ protected:
 
 private:
 
+  // The search itself, runImpl only takes care of the worker processes
+  MainLoopResult searchForModel();
+
   // Creates the model output
   void onModelFound();
 
@@ -101,7 +108,9 @@ private:
     for(unsigned s=0;s<_sortedSignature->sorts;s++){
       //std::cout << "SORT " << s << std::endl;
       unsigned modelSize = _sortModelSizes[s];
-      for(unsigned m=1;m<=modelSize;m++){
+      // with an incremental encoding the axioms for the smaller sizes are already in the solver
+      unsigned firstSize = _encodedSortSizes[_sortedSignature->parents[s]]+1;
+      for(unsigned m=firstSize;m<=modelSize;m++){
         //std::cout << "MSIZE " << m << std::endl;
         addNewSymmetryOrderingAxioms(m,_sortedGroundedTerms[s]);
         addNewSymmetryCanonicityAxioms(m,_sortedGroundedTerms[s],modelSize);
@@ -120,12 +129,22 @@ private:
 
   // resets all structures and SAT solver using _sortModelSizes 
   bool reset();
+  // computes the SAT variable offsets for _distinctSortCapacities, false on overflow
+  bool computeOffsets(unsigned& offsets);
 
   // make the symmetry orderings
   void createSymmetryOrdering();
   // The per-sort ordering of grounded terms used for symmetry breaking
   DArray<Stack<GroundedTerm>> _sortedGroundedTerms;
 
+  // Finds constants which can be swapped without changing the flattened clauses
+  // and moves each class of them next to each other in sortedConstants
+  void detectSymmetricConstants();
+  // Orders the values of interchangeable constants, i.e. a <= b for neighbours a,b of a class
+  void addNewSymmetricConstantAxioms();
+  // Per sort, the classes of interchangeable constants as (first index, length) in sortedConstants
+  DArray<Stack<std::pair<unsigned,unsigned>>> _symmetricConstants;
+
   unsigned _curMaxVar;
   // SAT solver used to solve constraints (a new one is used for each model size)
   ScopedPtr<SATSolverWithAssumptions> _solver;
@@ -139,17 +158,31 @@ private:
   Stack<unsigned> _sortFunctions; // sort functions to remember - need to be eliminated from the model in the end
   Stack<unsigned> _sortPredicates; // sort predicates to remember - need to be eliminated from the model in the end
 
-  // Add a SATClause to the SAT solver
-  void addSATClause(SATClause* cl);
-  // Add a singleton SATClause in the form of a SATLiteral to the SAT solver
+  // Add a clause to the SAT solver (the literals get sorted)
+  void addSATClause(SATLiteralStack& lits);
+  // Add a singleton clause in the form of a SATLiteral to the SAT solver
   void addSATClause(SATLiteral lit){
     static SATLiteralStack satClauseLits;
     satClauseLits.reset();
     satClauseLits.push(lit);
-    addSATClause(SATClause::fromStack(satClauseLits));
+    addSATClause(satClauseLits);
   }
-  // SAT clauses to be added. We record them so we can delete them after calling the SAT solver
-  SATClauseStack _clausesToBeAdded;
+  // SAT clauses to be added
+  SATClauseArena _clausesToBeAdded;
+  // Passes _clausesToBeAdded to the solver and empties it, done whenever enough of them pile up
+  void flushSATClauses();
+  // How many clauses went to the solver since the last call to it
+  unsigned _clausesFlushed;
+
+  // With _pruneInstances the instances satisfied by the unit facts are not generated
+  // and the literals falsified by them are left out
+  bool _pruneInstances;
+  // Unit facts in the solver: SAT variable -> its value
+  DHMap<unsigned,bool> _knownLiterals;
+  // The known values of grounded functions, keyed by the SAT variable for the value 1
+  DHMap<unsigned,unsigned> _knownValues;
+  // Whether the unit facts decide the grounded literal (and how)
+  bool isKnown(unsigned func, DArray<unsigned>& elements, bool isFunction, bool& value);
 
   // The inferred signature of sorts (see SortInference.hpp)
   SortedSignature* _sortedSignature;
@@ -165,7 +198,7 @@ private:
 
   // There is a implicit mapping from ground terms to SAT variables
   // These offsets give the SAT variable for the *first* grounding of each function or predicate symbol
-  // Then the SAT variables for other groundings can be computed from this
+  // Then the SAT variables for other groundings can be computed from this (using _sortCapacities)
   DArray<unsigned> f_offsets;
   DArray<unsigned> p_offsets;
 
@@ -217,6 +250,8 @@ private:
   bool _isAppropriate;
   // Option used in symmetry breaking
   float _symmetryRatio;
+  // Look for interchangeable constants (fmb_symmetry_detection)
+  bool _detectSymmetries;
 
   // how often do we pick the next domain to grow by size and how often by weight (= encoding size estimate)
   unsigned _sizeWeightRatio;
@@ -225,6 +260,23 @@ private:
   DArray<unsigned> _sortModelSizes;
   DArray<unsigned> _distinctSortSizes;
 
+  // With _incremental (only for the contour encoding) the SAT solver is kept as long as
+  // the sorts fit into their capacities and only the constraints new for the grown sizes are added
+  bool _incremental;
+  // The sizes the SAT variables are numbered for; same as _distinctSortSizes unless _incremental
+  DArray<unsigned> _distinctSortCapacities;
+  DArray<unsigned> _sortCapacities;
+  // The sizes of distinct sorts whose constraints are already in the solver (all 0 for a new solver)
+  DArray<unsigned> _encodedSortSizes;
+
+  bool hasEncoding() const {
+    return _encodedSortSizes.size() && _encodedSortSizes[0];
+  }
+  // Is the constraint for @b element of sort @b srt already in the solver?
+  bool encoded(unsigned srt, unsigned element) const {
+    return element <= _encodedSortSizes[_sortedSignature->parents[srt]];
+  }
+
   enum ConstraintSign {
     EQ,     // the value has to matched
     LEQ,    // the value needs to be less or equal
@@ -245,6 +297,37 @@ private:
 
   DSAEnumerator* _dsaEnumerator;
 
+  // Parallel search (see fmb_workers):
+  // forks the worker processes, returns true in the parent
+  bool forkWorkers();
+  // waits until a worker finds a model or all of them give up
+  MainLoopResult collectWorkers();
+  // publishes the nogood for the other workers
+  void shareNogood(Constraint_Generator_Vals& nogood, unsigned weight);
+  // learns the nogoods and the size assignments being tried by the other workers
+  void importFromOtherWorkers();
+  // learns the nogoods of all the workers in the parent, true if no assignment is left
+  bool learnWorkerNogoods();
+  // publishes the size assignment this worker is about to try
+  void claimSizes();
+
+  unsigned _workers;
+  // Index of this worker process or UINT_MAX if we are not in one
+  unsigned _workerIndex;
+  // This worker gave up because it ran out of size assignments to try
+  bool _workerExhausted;
+  // Memory shared among the workers, laid out by forkWorkers()
+  std::atomic<unsigned>* _shared;
+  size_t _sharedWords;
+  // How many of the shared nogoods has this worker learned
+  unsigned _sharedNogoodsSeen;
+  // The last claim of every worker this one has learned
+  DArray<unsigned> _claimsSeen;
+  // Workers still running (only in the parent)
+  Stack<pid_t> _workerPids;
+  // The winning worker leaves the model here for the parent to print
+  FILE* _modelFile;
+
   class HackyDSAE : public DSAEnumerator {
     struct Constraint_Generator {
       Constraint_Generator_Vals _vals;
@@ -174,6 +174,7 @@ namespace SAT
 using namespace Lib;
 
 class SATClause;
+class SATClauseArena;
 class Z3Interfacing;
 class SATLiteral;
 class SATInference;
@@ -191,6 +192,7 @@ namespace Shell
 class Options;
 class Property;
 class Statistics;
+class SineIndex;
 class FunctionDefinitionHandler;
 class PartialRedundancyHandler;
 struct PartialRedundancyEntry;
@@ -25,6 +25,7 @@
 #include "LiteralIndexingStructure.hpp"
 
 #include "Lib/Allocator.hpp"
+#include "Lib/Recycled.hpp"
 
 namespace Indexing
 {
@@ -60,6 +61,48 @@ public:
 
   virtual void output(std::ostream& out) const final override { out << _ct; }
 
+  /**
+   * Generalizations of a term, retrieved without a VirtualIterator and
+   * without a ResultSubstitution. The bindings of the variables of the
+   * last returned data are read directly from the code tree matcher,
+   * which is possible as the indexed data have normalized variables.
+   */
+  class Generalizations
+  {
+  public:
+    Generalizations(CodeTreeTIS& tis, TermList t) : _finished(tis._ct.isEmpty())
+    {
+      if (!_finished) {
+        _matcher->init(&tis._ct, t);
+      }
+    }
+
+    /** Return the next generalization, or nullptr if there is none */
+    Data* next()
+    {
+      if (_finished) {
+        return nullptr;
+      }
+      Data* res = _matcher->next();
+      _finished = !res;
+      return res;
+    }
+
+    /** Return the term bound to variable @b v of the last generalization */
+    TermList operator()(unsigned v) const { return _matcher->bindings[v]; }
+
+  private:
+    bool _finished;
+    Recycled<typename TermCodeTree<Data>::TermMatcher> _matcher;
+  };
+
+  template<class D = Data>
+  Generalizations generalizations(TermList t)
+  {
+    static_assert(is_indexed_data_normalized<D>::value);
+    return Generalizations(*this, t);
+  }
+
 private:
   class ResultIterator;
 
@@ -31,6 +31,9 @@ Index::~Index()
     _addedSD->unsubscribe();
     _removedSD->unsubscribe();
   }
+  if(!_frozenDroppedSD.isEmpty()) {
+    _frozenDroppedSD->unsubscribe();
+  }
 }
 
 /**
@@ -44,6 +47,9 @@ void Index::attachContainer(ClauseContainer* cc)
 
   _addedSD = cc->addedEvent.subscribe(this,&Index::onAddedToContainer);
   _removedSD = cc->removedEvent.subscribe(this,&Index::onRemovedFromContainer);
+  if(_retainFrozen) {
+    _frozenDroppedSD = cc->frozenDroppedEvent.subscribe(this,&Index::onFrozenDropped);
+  }
 }
 
 }
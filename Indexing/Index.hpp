@@ -191,21 +191,50 @@ public:
   virtual ~Index();
 
   void attachContainer(ClauseContainer* cc);
+
+  /** Whether the index can keep frozen clauses and hide them from its retrievals */
+  virtual bool canRetainFrozen() const { return false; }
+  /**
+   * Keep frozen clauses (see ActiveClauseContainer::freeze) in the index,
+   * so that their reactivation does not need to insert them again.
+   * Must be called before attaching a container.
+   */
+  void retainFrozen()
+  {
+    ASS(canRetainFrozen());
+    ASS(_addedSD.isEmpty());
+    _retainFrozen = true;
+  }
 protected:
-  Index() {}
+  Index() : _retainFrozen(false) {}
 
   void onAddedToContainer(Clause* c)
-  { handleClause(c, true); }
+  {
+    if (_retainFrozen && c->isFrozen()) {
+      return; // still in the index from before it was frozen
+    }
+    handleClause(c, true);
+  }
   void onRemovedFromContainer(Clause* c)
+  {
+    if (_retainFrozen && c->isFrozen()) {
+      return;
+    }
+    handleClause(c, false);
+  }
+  void onFrozenDropped(Clause* c)
   { handleClause(c, false); }
 
   virtual void handleClause(Clause* c, bool adding) {}
 
   //TODO: postponing index modifications during iteration (methods isBeingIterated() etc...)
 
+  /** Frozen clauses are kept in the index, retrievals must skip them */
+  bool _retainFrozen;
 private:
   SubscriptionData _addedSD;
   SubscriptionData _removedSD;
+  SubscriptionData _frozenDroppedSD;
 };
 
 };
@@ -284,6 +284,9 @@ Index* IndexManager::create(IndexType t)
     INVALID_OPERATION("Unsupported IndexType.");
   }
   if(isGenerating) {
+    if(_alg->getOptions().splittingLazyReinsertion() && res->canRetainFrozen()) {
+      res->retainFrozen();
+    }
     res->attachContainer(_alg->getGeneratingClauseContainer());
   }
   else {
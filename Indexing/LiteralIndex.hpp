@@ -18,6 +18,7 @@
 
 #include "Lib/Output.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/Metaiterators.hpp"
 
 #include "Index.hpp"
 #include "LiteralIndexingStructure.hpp"
@@ -31,22 +32,45 @@ class LiteralIndex
 {
 public:
   VirtualIterator<LiteralClause> getAll()
-  { return _is->getAll(); }
+  {
+    if (_retainFrozen) {
+      return pvi(iterTraits(_is->getAll())
+        .filter([](LiteralClause const& lc) { return !lc.clause->isFrozen(); }));
+    }
+    return _is->getAll();
+  }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, LiteralClause>> getUnifications(Literal* lit, bool complementary, bool retrieveSubstitutions = true)
-  { return _is->getUnifications(lit, complementary, retrieveSubstitutions); }
+  { return withoutFrozen(_is->getUnifications(lit, complementary, retrieveSubstitutions)); }
 
   VirtualIterator<QueryRes<AbstractingUnifier*, Data>> getUwa(Literal* lit, bool complementary, Options::UnificationWithAbstraction uwa, bool fixedPointIteration)
-  { return _is->getUwa(lit, complementary, uwa, fixedPointIteration); }
+  { return withoutFrozen(_is->getUwa(lit, complementary, uwa, fixedPointIteration)); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, LiteralClause>> getGeneralizations(Literal* lit, bool complementary, bool retrieveSubstitutions = true)
-  { return _is->getGeneralizations(lit, complementary, retrieveSubstitutions); }
+  { return withoutFrozen(_is->getGeneralizations(lit, complementary, retrieveSubstitutions)); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, LiteralClause>> getInstances(Literal* lit, bool complementary, bool retrieveSubstitutions = true)
-  { return _is->getInstances(lit, complementary, retrieveSubstitutions); }
+  { return withoutFrozen(_is->getInstances(lit, complementary, retrieveSubstitutions)); }
+
+  Data const* getSomeGeneralization(Literal* lit, bool complementary)
+  {
+    if (_retainFrozen) {
+      auto it = getGeneralizations(lit, complementary, /* retrieveSubstitutions */ false);
+      return it.hasNext() ? it.next().data : nullptr;
+    }
+    return _is->getSomeGeneralization(lit, complementary);
+  }
 
   size_t getUnificationCount(Literal* lit, bool complementary)
-  { return _is->getUnificationCount(lit, complementary); }
+  {
+    if (_retainFrozen) {
+      return iterTraits(getUnifications(lit, complementary, /* retrieveSubstitutions */ false)).count();
+    }
+    return _is->getUnificationCount(lit, complementary);
+  }
+
+  bool canRetainFrozen() const override
+  { return std::is_same_v<Data, LiteralClause>; }
 
   friend std::ostream& operator<<(std::ostream& out,                 LiteralIndex const& self) { return out << *self._is; }
   friend std::ostream& operator<<(std::ostream& out, Output::Multiline<LiteralIndex>const& self) { return out << Output::multiline(*self.self._is, self.indent); }
@@ -57,6 +81,16 @@ protected:
   void handle(Data data, bool add)
   { _is->handle(std::move(data), add); }
 
+  template<class Unifier, class D>
+  VirtualIterator<QueryRes<Unifier, D>> withoutFrozen(VirtualIterator<QueryRes<Unifier, D>> it)
+  {
+    if (_retainFrozen) {
+      return pvi(iterTraits(std::move(it))
+        .filter([](QueryRes<Unifier, D> const& qr) { return !qr.data->clause->isFrozen(); }));
+    }
+    return it;
+  }
+
   std::unique_ptr<LiteralIndexingStructure<Data>> _is;
 };
 
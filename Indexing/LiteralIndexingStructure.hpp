@@ -41,6 +41,13 @@ public:
   virtual VirtualIterator<QueryRes<ResultSubstitutionSP, LeafData>> getInstances(Literal* lit, bool complementary, bool retrieveSubstitutions = true) { NOT_IMPLEMENTED; }
   virtual VirtualIterator<QueryRes<ResultSubstitutionSP, LeafData>> getVariants(Literal* lit, bool complementary, bool retrieveSubstitutions = true) { NOT_IMPLEMENTED; }
 
+  /** Return the data of some generalization of @b lit, or nullptr if there is none */
+  virtual LeafData const* getSomeGeneralization(Literal* lit, bool complementary)
+  {
+    auto it = getGeneralizations(lit, complementary, false);
+    return it.hasNext() ? it.next().data : nullptr;
+  }
+
   virtual size_t getUnificationCount(Literal* lit, bool complementary)
   {
     return countIteratorElements(getUnifications(lit, complementary, false));
@@ -67,6 +67,16 @@ public:
   VirtualIterator<QueryRes<ResultSubstitutionSP, LeafData>> getGeneralizations(Literal* lit, bool complementary, bool retrieveSubstitutions) final override
   { return pvi(getResultIterator<FastGeneralizationsIterator>(lit, complementary, retrieveSubstitutions)); }
 
+  LeafData const* getSomeGeneralization(Literal* lit, bool complementary) final override
+  {
+    auto& tree = getTree(lit, complementary);
+    auto res = tree.someGeneralization(lit, /* reversed */ false);
+    if (!res && lit->isEquality()) {
+      res = tree.someGeneralization(lit, /* reversed */ true);
+    }
+    return res;
+  }
+
   VirtualIterator<QueryRes<ResultSubstitutionSP, LeafData>> getInstances(Literal* lit, bool complementary, bool retrieveSubstitutions) final override
   { return pvi(getResultIterator<FastInstancesIterator>(lit, complementary, retrieveSubstitutions)); }
 
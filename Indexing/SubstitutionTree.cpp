@@ -521,11 +521,14 @@ SubstitutionTree<LeafData_>::LeafIterator::LeafIterator(SubstitutionTree* st)
   : _curr()
   , _nodeIterators()
 {
-  if (st->_root->isLeaf()) {
+  if (!st->_root) {
+    _curr = nullptr;
+  } else if (st->_root->isLeaf()) {
     _curr = st->_root;
   } else {
     _curr = nullptr;
     _nodeIterators.push(static_cast<IntermediateNode*>(st->_root)->allChildren());
+    skipToNextLeaf();
   }
 }
 
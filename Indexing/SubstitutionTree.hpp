@@ -629,6 +629,21 @@ public:
         : FastGeneralizationsIterator(this, _root, query, /* retrieveSubstitutions */ false, /* reversed */ false).hasNext();
     }
 
+    /**
+     * Return some generalization of @b query, or nullptr if there is none.
+     * Unlike iterator(), this neither boxes the retrieval iterator nor
+     * computes substitutions.
+     */
+    template<class Query>
+    LeafData const* someGeneralization(Query query, bool reversed)
+    {
+      if (_root == nullptr) {
+        return nullptr;
+      }
+      Recycled<FastGeneralizationsIterator> it(this, _root, query, /* retrieveSubstitutions */ false, reversed);
+      return it->hasNext() ? it->next().data : nullptr;
+    }
+
     template<class Query>
     VirtualIterator<QueryRes<ResultSubstitutionSP, LeafData>> getVariants(Query query, bool retrieveSubstitutions)
     {
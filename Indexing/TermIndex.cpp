@@ -132,6 +132,10 @@ void DemodulationLHSIndex::handleClause(Clause* c, bool adding)
   while (lhsi.hasNext()) {
     auto lhs = lhsi.next();
 
+    if (adding) {
+      _irreducible.reset();
+    }
+
     // DemodulatorData expects lhs and rhs to be normalized
     Renaming r;
     r.normalizeVariables(lhs);
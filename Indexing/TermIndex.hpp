@@ -18,9 +18,12 @@
 
 #include "Index.hpp"
 #include "TermIndexingStructure.hpp"
+#include "CodeTreeInterfaces.hpp"
 
 #include "Indexing/TermSubstitutionTree.hpp"
 #include "TermIndexingStructure.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/Metaiterators.hpp"
 #include "Lib/Set.hpp"
 
 namespace Indexing {
@@ -33,22 +36,37 @@ public:
   virtual ~TermIndex() {}
 
   VirtualIterator<QueryRes<AbstractingUnifier*, Data>> getUwa(TypedTermList t, Options::UnificationWithAbstraction uwa, bool fixedPointIteration)
-  { return _is->getUwa(t, uwa, fixedPointIteration); }
+  { return withoutFrozen(_is->getUwa(t, uwa, fixedPointIteration)); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getUnifications(TypedTermList t, bool retrieveSubstitutions = true)
-  { return _is->getUnifications(t, retrieveSubstitutions); }
+  { return withoutFrozen(_is->getUnifications(t, retrieveSubstitutions)); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getGeneralizations(TypedTermList t, bool retrieveSubstitutions = true)
-  { return _is->getGeneralizations(t, retrieveSubstitutions); }
+  { return withoutFrozen(_is->getGeneralizations(t, retrieveSubstitutions)); }
 
   VirtualIterator<QueryRes<ResultSubstitutionSP, Data>> getInstances(TypedTermList t, bool retrieveSubstitutions = true)
-  { return _is->getInstances(t, retrieveSubstitutions); }
+  { return withoutFrozen(_is->getInstances(t, retrieveSubstitutions)); }
+
+  bool canRetainFrozen() const override
+  { return std::is_same_v<Data, TermLiteralClause>; }
 
   friend std::ostream& operator<<(std::ostream& out, TermIndex const& self)
   { return out << *self._is; }
 protected:
   TermIndex(TermIndexingStructure<Data>* is) : _is(is) {}
 
+  template<class Unifier>
+  VirtualIterator<QueryRes<Unifier, Data>> withoutFrozen(VirtualIterator<QueryRes<Unifier, Data>> it)
+  {
+    if constexpr (std::is_same_v<Data, TermLiteralClause>) {
+      if (_retainFrozen) {
+        return pvi(iterTraits(std::move(it))
+          .filter([](QueryRes<Unifier, Data> const& qr) { return !qr.data->clause->isFrozen(); }));
+      }
+    }
+    return it;
+  }
+
   std::unique_ptr<TermIndexingStructure<Data>> _is;
 };
 
@@ -113,13 +131,34 @@ class DemodulationLHSIndex
 : public TermIndex<DemodulatorData>
 {
 public:
-  DemodulationLHSIndex(TermIndexingStructure<DemodulatorData>* is, Ordering& ord, const Options& opt)
-  : TermIndex(is), _ord(ord), _opt(opt) {};
+  DemodulationLHSIndex(CodeTreeTIS<DemodulatorData>* is, Ordering& ord, const Options& opt)
+  : TermIndex(is), _ct(is), _ord(ord), _opt(opt) {};
+
+  /** Demodulators whose lhs generalizes @b t, see CodeTreeTIS::Generalizations */
+  CodeTreeTIS<DemodulatorData>::Generalizations generalizations(TermList t)
+  { return _ct->generalizations(t); }
+
+  /**
+   * Return true if @b t is known not to be rewritable by any
+   * demodulator currently in the index, regardless of the clause
+   * it occurs in.
+   */
+  bool isIrreducible(Term* t) const { return _irreducible.contains(t); }
+  void markIrreducible(Term* t) { _irreducible.insert(t); }
 protected:
   void handleClause(Clause* c, bool adding);
 private:
+  /** the indexing structure, owned by TermIndex */
+  CodeTreeTIS<DemodulatorData>* _ct;
   Ordering& _ord;
   const Options& _opt;
+
+  /**
+   * Terms for which no demodulator in the index applies. Removing
+   * demodulators keeps them irreducible, so the set is only reset
+   * when a demodulator is added.
+   */
+  DHSet<Term*> _irreducible;
 };
 
 /**
@@ -56,11 +56,32 @@ void BackwardDemodulation::attach(SaturationAlgorithm* salg)
   BackwardSimplificationEngine::attach(salg);
   _index=static_cast<DemodulationSubtermIndex*>(
 	  _salg->getIndexManager()->request(DEMODULATION_SUBTERM_SUBST_TREE) );
+  init();
+}
+
+#if VDEBUG
+void BackwardDemodulation::setTestIndices(Stack<Index*> const& indices)
+{
+  _index = static_cast<DemodulationSubtermIndex*>(indices[0]);
+  init();
+}
+#endif
+
+void BackwardDemodulation::init()
+{
   _helper = DemodulationHelper(getOptions(), &_salg->getOrdering());
+  _batchSize = getOptions().backwardDemodulationBatch();
+  _activations = 0;
 }
 
 void BackwardDemodulation::detach()
 {
+  while (_pending.isNonEmpty()) {
+    _pending.pop()->decRefCnt();
+  }
+  while (_swept.isNonEmpty()) {
+    _swept.pop()->decRefCnt();
+  }
   _index=0;
   _salg->getIndexManager()->release(DEMODULATION_SUBTERM_SUBST_TREE);
   BackwardSimplificationEngine::detach();
@@ -99,14 +120,11 @@ struct Applicator : SubstApplicator {
 
 struct BackwardDemodulation::ResultFn
 {
-  typedef DHMultiset<Clause*> ClauseSet;
-
-  ResultFn(Clause* cl, BackwardDemodulation& parent, const DemodulationHelper& helper)
-  : _cl(cl), _helper(helper), _ordering(parent._salg->getOrdering())
+  ResultFn(Clause* cl, BackwardDemodulation& parent, const DemodulationHelper& helper, SmartPtr<ClauseSet> removed)
+  : _cl(cl), _removed(removed), _helper(helper), _ordering(parent._salg->getOrdering())
   {
     ASS_EQ(_cl->length(),1);
     _eqLit=(*_cl)[0];
-    _removed=SmartPtr<ClauseSet>(new ClauseSet());
   }
 
   /**
@@ -125,7 +143,7 @@ struct BackwardDemodulation::ResultFn
 
     if(_cl==qr.data->clause || _removed->find(qr.data->clause)) {
       //the retreived clause was already replaced during this
-      //backward demodulation
+      //backward demodulation (or sweep)
       return BwSimplificationRecord(0);
     }
 
@@ -195,33 +213,95 @@ private:
 };
 
 
-void BackwardDemodulation::perform(Clause* cl,
-	BwSimplificationRecordIterator& simplifications)
+/**
+ * Return the simplifications of indexed clauses by the unit equation @b eq.
+ * Clauses in @b removed are skipped, and the simplified ones are added to it.
+ */
+BwSimplificationRecordIterator BackwardDemodulation::rewrites(Clause* eq, SmartPtr<ClauseSet> removed)
 {
-  TIME_TRACE("backward demodulation");
-
-  if(cl->length()!=1 || !(*cl)[0]->isEquality() || !(*cl)[0]->isPositive() ) {
-    simplifications=BwSimplificationRecordIterator::getEmpty();
-    return;
-  }
-  Literal* lit=(*cl)[0];
+  Literal* lit=(*eq)[0];
 
-  BwSimplificationRecordIterator replacementIterator=
-    pvi( getFilteredIterator(
+  return pvi( getFilteredIterator(
 	    getMappingIterator(
 		    getMapAndFlattenIterator(
 			    EqHelper::getDemodulationLHSIterator(lit,
             _salg->getOptions().backwardDemodulation() == Options::Demodulation::PREORDERED,
             _salg->getOrdering()).first,
 			    RewritableClausesFn(_index)),
-		    ResultFn(cl, *this, _helper)),
+		    ResultFn(eq, *this, _helper, removed)),
  	    RemovedIsNonzeroFn()) );
+}
+
+void BackwardDemodulation::perform(Clause* cl,
+	BwSimplificationRecordIterator& simplifications)
+{
+  TIME_TRACE("backward demodulation");
+
+  if (_batchSize>1) {
+    performBatched(cl, simplifications);
+    return;
+  }
+
+  if(cl->length()!=1 || !(*cl)[0]->isEquality() || !(*cl)[0]->isPositive() ) {
+    simplifications=BwSimplificationRecordIterator::getEmpty();
+    return;
+  }
 
   //here we know that the getPersistentIterator evaluates all items of the
   //replacementIterator right at this point, so we can measure the time just
   //simply (which cannot be generally done when iterators are involved)
 
-  simplifications=getPersistentIterator(replacementIterator);
+  simplifications=getPersistentIterator(rewrites(cl, SmartPtr<ClauseSet>(new ClauseSet())));
+}
+
+/**
+ * Collect unit equations and rewrite the indexed clauses with all of them
+ * in one sweep every @b _batchSize activations. Each clause is simplified
+ * at most once per sweep; its replacement is then brought to normal form
+ * by forward demodulation, as all the collected equations are already in
+ * the forward demodulation index.
+ */
+void BackwardDemodulation::performBatched(Clause* cl,
+	BwSimplificationRecordIterator& simplifications)
+{
+  // the records of the previous sweep have been processed by now
+  while (_swept.isNonEmpty()) {
+    _swept.pop()->decRefCnt();
+  }
+
+  if(cl->length()==1 && (*cl)[0]->isEquality() && (*cl)[0]->isPositive()) {
+    cl->incRefCnt();
+    _pending.push(cl);
+  }
+
+  if (++_activations<_batchSize || _pending.isEmpty()) {
+    simplifications=BwSimplificationRecordIterator::getEmpty();
+    return;
+  }
+  _activations = 0;
+
+  SmartPtr<ClauseSet> removed(new ClauseSet());
+  // the clause being activated must not be simplified away here
+  removed->insert(cl);
+
+  Stack<BwSimplificationRecord> records;
+  for (Clause* eq : _pending) {
+    // equations deleted since they were collected are not used
+    if (eq->store()!=Clause::NONE) {
+      auto it = rewrites(eq, removed);
+      while (it.hasNext()) {
+        BwSimplificationRecord rec = it.next();
+        // the simplification depends on eq (and its splits), not on the activated clause
+        rec.premise = eq;
+        records.push(rec);
+      }
+    }
+    // stays referenced while the records mention it
+    _swept.push(eq);
+  }
+  _pending.reset();
+
+  simplifications=pvi(arrayIter(std::move(records)));
 }
 
 }
@@ -17,6 +17,8 @@
 #define __BackwardDemodulation__
 
 #include "Forwards.hpp"
+#include "Lib/DHMultiset.hpp"
+#include "Lib/Stack.hpp"
 #include "Indexing/TermIndex.hpp"
 
 #include "DemodulationHelper.hpp"
@@ -36,13 +38,32 @@ public:
   void detach();
 
   void perform(Clause* premise, BwSimplificationRecordIterator& simplifications);
+#if VDEBUG
+  void setTestIndices(Stack<Indexing::Index*> const& indices) override;
+#endif
 private:
+  void init();
+
   struct RemovedIsNonzeroFn;
   struct RewritableClausesFn;
   struct ResultFn;
 
+  typedef DHMultiset<Clause*> ClauseSet;
+
+  BwSimplificationRecordIterator rewrites(Clause* eq, SmartPtr<ClauseSet> removed);
+  void performBatched(Clause* premise, BwSimplificationRecordIterator& simplifications);
+
   DemodulationSubtermIndex* _index;
   DemodulationHelper _helper;
+
+  /** number of activations between two sweeps, 1 means no batching */
+  unsigned _batchSize;
+  /** activations since the last sweep */
+  unsigned _activations;
+  /** unit equations waiting for the next sweep, referenced by us */
+  Stack<Clause*> _pending;
+  /** equations of the last sweep, referenced by us as its records point to them */
+  Stack<Clause*> _swept;
 };
 
 using BackwardDemodulationExtra = RewriteInferenceExtra;
@@ -261,21 +261,26 @@ Clause* BinaryResolution::generateClause(Clause* queryCl, Literal* queryLit,
       &salg->getOrdering(), &salg->getLiteralSelector(), &salg->parRedHandler());
 }
 
-ClauseIterator BinaryResolution::generateClauses(Clause* premise)
+void BinaryResolution::pushClauses(Clause* premise, ClauseSink& sink)
 {
-  return pvi(TIME_TRACE_ITER("resolution",
-      premise->getSelectedLiteralIterator()
-      // TODO filter out >= in alasca
-        .filter([](auto l) { return !l->isEquality(); })
-        .flatMap([this,premise](auto lit) {
-            // find query results for literal `lit`
-            return iterTraits(_index->getUwa(lit, /* complementary */ true,
-                                             env.options->unificationWithAbstraction(),
-                                             env.options->unificationWithAbstractionFixedPointIteration()))
-                     .map([this,lit,premise](auto qr) { return BinaryResolution::generateClause(premise, lit, qr.data->clause, qr.data->literal, *qr.unifier, this->getOptions(), _salg); });
-        })
-        .filter(NonzeroFn())
-  ));
+  TIME_TRACE("resolution");
+
+  for (Literal* lit : premise->getSelectedLiteralIterator()) {
+    // TODO filter out >= in alasca
+    if (lit->isEquality()) {
+      continue;
+    }
+    // find query results for literal `lit`
+    auto unifs = _index->getUwa(lit, /* complementary */ true,
+                                env.options->unificationWithAbstraction(),
+                                env.options->unificationWithAbstractionFixedPointIteration());
+    while (unifs.hasNext()) {
+      auto qr = unifs.next();
+      if (auto res = BinaryResolution::generateClause(premise, lit, qr.data->clause, qr.data->literal, *qr.unifier, this->getOptions(), _salg)) {
+        sink.add(res);
+      }
+    }
+  }
 }
 
 }
@@ -52,7 +52,9 @@ public:
                                 ResultSubstitutionSP subs, ComputeConstraints constraints, const Options& opts,
                                 bool afterCheck = false, PassiveClauseContainer* passive=0, Ordering* ord=0, LiteralSelector* ls = 0, PartialRedundancyHandler const* parRedHandler = 0);
 
-  ClauseIterator generateClauses(Clause* premise);
+  ClauseIterator generateClauses(Clause* premise) override
+  { return collectPushedClauses(premise); }
+  void pushClauses(Clause* premise, ClauseSink& sink) override;
 
 private:
   Clause* generateClause(
@@ -56,20 +56,22 @@ using namespace Saturation;
 
 namespace {
 
+using Generalizations = CodeTreeTIS<DemodulatorData>::Generalizations;
+
 struct Applicator : SubstApplicator {
-  Applicator(ResultSubstitution* subst) : subst(subst) {}
+  Applicator(const Generalizations& subst) : subst(subst) {}
   TermList operator()(unsigned v) const override {
-    return subst->applyToBoundResult(v);
+    return subst(v);
   }
-  ResultSubstitution* subst;
+  const Generalizations& subst;
 };
 
 struct ApplicatorWithEqSort : SubstApplicator {
-  ApplicatorWithEqSort(ResultSubstitution* subst, const RobSubstitution& vSubst) : subst(subst), vSubst(vSubst) {}
+  ApplicatorWithEqSort(const Generalizations& subst, const RobSubstitution& vSubst) : subst(subst), vSubst(vSubst) {}
   TermList operator()(unsigned v) const override {
-    return vSubst.apply(subst->applyToBoundResult(v), 0);
+    return vSubst.apply(subst(v), 0);
   }
-  ResultSubstitution* subst;
+  const Generalizations& subst;
   const RobSubstitution& vSubst;
 };
 
@@ -132,19 +134,28 @@ bool ForwardDemodulationImpl<combinatorySupSupport>::perform(Clause* cl, Clause*
         it.right();
         continue;
       }
+      if (_index->isIrreducible(trm.term())) {
+        // no demodulator applies to @b trm itself, but its subterms
+        // may not have been tried yet, so we still descend into them
+        continue;
+      }
+      // whether the failure to rewrite @b trm does not depend on @b cl
+      bool clauseIndependent = true;
 
       bool redundancyCheck = _helper.redundancyCheckNeededForPremise(cl, lit, trm);
 
-      auto git = _index->getGeneralizations(trm.term(), /* retrieveSubstitutions */ true);
-      while(git.hasNext()) {
-        auto qr=git.next();
-        ASS_EQ(qr.data->clause->length(),1);
+      // the code tree is queried directly, which avoids boxing the results
+      // and reads the matching substitution from the matcher bindings
+      auto git = _index->generalizations(trm);
+      while(auto data=git.next()) {
+        ASS_EQ(data->clause->length(),1);
 
-        if(!ColorHelper::compatible(cl->color(), qr.data->clause->color())) {
+        if(!ColorHelper::compatible(cl->color(), data->clause->color())) {
+          clauseIndependent = false;
           continue;
         }
 
-        auto lhs = qr.data->term;
+        auto lhs = data->term;
 
         // TODO:
         // to deal with polymorphic matching
@@ -157,21 +168,18 @@ bool ForwardDemodulationImpl<combinatorySupSupport>::perform(Clause* cl, Clause*
         if(lhs.isVar()){
           eqSortSubs.reset();
           TermList querySort = trm.sort();
-          TermList eqSort = qr.data->term.sort();
+          TermList eqSort = data->term.sort();
           if(!eqSortSubs.match(eqSort, 0, querySort, 1)){
             continue;
           }
         }
 
-        auto subs = qr.unifier;
-        ASS(subs->isIdentityOnQueryWhenResultBound());
-
-        ApplicatorWithEqSort applWithEqSort(subs.ptr(), eqSortSubs);
-        Applicator applWithoutEqSort(subs.ptr());
+        ApplicatorWithEqSort applWithEqSort(git, eqSortSubs);
+        Applicator applWithoutEqSort(git);
         auto appl = lhs.isVar() ? (SubstApplicator*)&applWithEqSort : (SubstApplicator*)&applWithoutEqSort;
 
-        AppliedTerm rhsApplied(qr.data->rhs,appl,true);
-        bool preordered = qr.data->preordered;
+        AppliedTerm rhsApplied(data->rhs,appl,true);
+        bool preordered = data->preordered;
 
         ASS_EQ(ordering.compare(trm,rhsApplied),Ordering::reverse(ordering.compare(rhsApplied,trm)));
 
@@ -179,8 +187,8 @@ bool ForwardDemodulationImpl<combinatorySupSupport>::perform(Clause* cl, Clause*
 #if VDEBUG
           auto dcomp = ordering.compareUnidirectional(trm,rhsApplied);
 #endif
-          qr.data->tod->init(appl);
-          if (!preordered && (_preorderedOnly || !qr.data->tod->next())) {
+          data->tod->init(appl);
+          if (!preordered && (_preorderedOnly || !data->tod->next())) {
             ASS_NEQ(dcomp,Ordering::GREATER);
             continue;
           }
@@ -206,13 +214,14 @@ bool ForwardDemodulationImpl<combinatorySupSupport>::perform(Clause* cl, Clause*
         TermList rhsS = rhsApplied.apply();
 
         if (redundancyCheck && !_helper.isPremiseRedundant(cl, lit, trm, rhsS, lhs, appl)) {
+          clauseIndependent = false;
           continue;
         }
 
         Literal* resLit = EqHelper::replace(lit,trm,rhsS);
         if(EqHelper::isEqTautology(resLit)) {
           env.statistics->forwardDemodulationsToEqTaut++;
-          premises = pvi( getSingletonIterator(qr.data->clause));
+          premises = pvi( getSingletonIterator(data->clause));
           return true;
         }
 
@@ -228,12 +237,15 @@ bool ForwardDemodulationImpl<combinatorySupSupport>::perform(Clause* cl, Clause*
 
         env.statistics->forwardDemodulations++;
 
-        premises = pvi( getSingletonIterator(qr.data->clause));
-        replacement = Clause::fromStack(*resLits, SimplifyingInference2(InferenceRule::FORWARD_DEMODULATION, cl, qr.data->clause));
+        premises = pvi( getSingletonIterator(data->clause));
+        replacement = Clause::fromStack(*resLits, SimplifyingInference2(InferenceRule::FORWARD_DEMODULATION, cl, data->clause));
         if(env.options->proofExtra() == Options::ProofExtra::FULL)
           env.proofExtra.insert(replacement, new ForwardDemodulationExtra(lhs, trm));
         return true;
       }
+      if (clauseIndependent) {
+        _index->markIrreducible(trm.term());
+      }
     }
   }
 
@@ -97,9 +97,8 @@ bool ForwardSubsumptionAndResolution::perform(Clause *cl,
   // Therefore L subsumes M
   for (unsigned li = 0; li < clen; li++) {
     Literal *lit = (*cl)[li];
-    auto it = _unitIndex->getGeneralizations(lit, false, false);
-    if (it.hasNext()) {
-      mcl = it.next().data->clause;
+    if (auto ld = _unitIndex->getSomeGeneralization(lit, false)) {
+      mcl = ld->clause;
       premise = mcl;
       ASS(ColorHelper::compatible(cl->color(), premise->color()))
       premises = pvi(getSingletonIterator(premise));
@@ -183,9 +182,8 @@ bool ForwardSubsumptionAndResolution::perform(Clause *cl,
   // This is why we do not chain subsumption resolutions.
   for (unsigned li = 0; li < clen; li++) {
     Literal *lit = (*cl)[li];
-    auto it = _unitIndex->getGeneralizations(lit, true, false);
-    if (it.hasNext()) {
-      mcl = it.next().data->clause;
+    if (auto ld = _unitIndex->getSomeGeneralization(lit, true)) {
+      mcl = ld->clause;
       ASS(mcl->length() == 1)
       replacement = SATSubsumption::SATSubsumptionAndResolution::getSubsumptionResolutionConclusion(cl, lit, mcl);
       premises = pvi(getSingletonIterator(mcl));
@@ -48,10 +48,14 @@ using namespace Saturation;
 
 GlobalSubsumption::GlobalSubsumption(const Options& opts) :
   _uprOnly(opts.globalSubsumptionSatSolverPower()==Options::GlobalSubsumptionSatSolverPower::PROPAGATION_ONLY),
+  _adaptiveBudget(opts.globalSubsumptionAdaptiveBudget()),
+  _solveBudget(_uprOnly ? 0u : UINT_MAX),
+  _minimBudget(_uprOnly ? 0u : UINT_MAX),
   _explicitMinim(opts.globalSubsumptionExplicitMinim()!=Options::GlobalSubsumptionExplicitMinim::OFF),
   _randomizeMinim(opts.globalSubsumptionExplicitMinim()==Options::GlobalSubsumptionExplicitMinim::RANDOMIZED),
   _splittingAssumps(opts.globalSubsumptionAvatarAssumptions()!= Options::GlobalSubsumptionAvatarAssumptions::OFF),
-  _splitter(0)
+  _splitter(0),
+  _namingSplitter(0)
 {
   _solver = new MinisatInterfacing(opts,true);
   _grounder = new GlobalSubsumptionGrounder(*_solver);
@@ -66,6 +70,33 @@ void GlobalSubsumption::attach(SaturationAlgorithm* salg)
   } else {
     _splitter = 0;
   }
+
+  if (_splittingAssumps && _salg->getOptions().globalSubsumptionSharedNaming()) {
+    _namingSplitter = _salg->getSplitter();
+  } else {
+    _namingSplitter = 0;
+  }
+}
+
+SATLiteral GlobalSubsumption::splitLevelToLiteral(SplitLevel lev)
+{
+  // a ground unit component is named by the literal of its grounding,
+  // so the AVATAR assignment speaks about the same atoms as the grounded clauses
+  if (_namingSplitter) {
+    Clause* comp = _namingSplitter->getComponentClause(lev);
+    if (comp->length() == 1 && (*comp)[0]->ground()) {
+      return _grounder->groundLiteral((*comp)[0]);
+    }
+  }
+
+  unsigned* pvar;
+
+  if(_splits2vars.getValuePtr(lev, pvar)) {
+    *pvar = _solver->newVar();
+    ALWAYS(_vars2splits.insert(*pvar,lev));
+  }
+
+  return SATLiteral(*pvar,true);
 }
 
 void GlobalSubsumption::detach()
@@ -73,6 +104,30 @@ void GlobalSubsumption::detach()
   ForwardSimplificationEngine::detach();
 }
 
+/**
+ * Return true iff all the split levels of the clauses in @c prems are active.
+ *
+ * With shared naming, a premise may depend on a named level whose literal
+ * was not assumed but propagated, and the replacement inherits that level.
+ */
+bool GlobalSubsumption::premisesActive(const Stack<Unit*>& prems)
+{
+  Stack<Unit*>::ConstIterator it(prems);
+  while (it.hasNext()) {
+    Unit* u = it.next();
+    if (!u->isClause() || !u->asClause()->splits()) {
+      continue;
+    }
+    auto sit = u->asClause()->splits()->iter();
+    while (sit.hasNext()) {
+      if (!_namingSplitter->splitLevelActive(sit.next())) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 /**
  * Perform GS on cl and return the reduced clause,
  * or cl itself if GS does not reduce.
@@ -104,6 +159,10 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   static DHMap<SATLiteral,Literal*> lookup;
   lookup.reset();
 
+  // split levels assumed through the literal of their ground component (only with _namingSplitter)
+  static DHMap<SATLiteral,SplitLevel> namedLevels;
+  namedLevels.reset();
+
   // first abstract cl's FO literals using grounder,
   // start filling assumps and initialize lookup
   _grounder->groundNonProp(cl, plits);
@@ -123,11 +182,27 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
     auto sit = cl->splits()->iter();
     while(sit.hasNext()) {
       SplitLevel l = sit.next();
-      unsigned var = splitLevelToVar(l);
+      SATLiteral slit = splitLevelToLiteral(l);
+
+      SplitLevel dummy;
+      bool named = _namingSplitter && !isSplitLevelVar(slit.var(),dummy);
+      if (named) {
+        if (plits.find(slit)) {
+          // cl contains the literal of one of its own ground components
+          return cl;
+        }
+        if (plits.find(slit.opposite())) {
+          // already there as one of cl's literals
+          continue;
+        }
+      }
 
-      plits.push(SATLiteral(var,false)); // negative
+      plits.push(slit.opposite()); // negative
       if (!_splitter) {
-        assumps.push(SATLiteral(var,true)); // positive
+        assumps.push(slit); // positive
+        if (named) {
+          namedLevels.insert(slit,l);
+        }
       }
     }
   }
@@ -139,8 +214,16 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
     SplitLevel bound = _splitter->splitLevelBound();
     for (SplitLevel lev = 0; lev < bound; lev++) {
       if (_splitter->splitLevelActive(lev)) {
-        unsigned var = splitLevelToVar(lev);
-        assumps.push(SATLiteral(var,true)); // positive
+        SATLiteral slit = splitLevelToLiteral(lev);
+        SplitLevel dummy;
+        if (_namingSplitter && !isSplitLevelVar(slit.var(),dummy)) {
+          if (assumps.find(slit) || assumps.find(slit.opposite())) {
+            // the component's literal is already assumed through (or clashes with) one of cl's literals
+            continue;
+          }
+          namedLevels.insert(slit,lev);
+        }
+        assumps.push(slit); // positive
       }
     }
   }
@@ -157,7 +240,8 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   _solver->addClause(scl);
 
   // check for subsuming clause by looking for a subset of used assumptions
-  SATSolver::Status res = _solver->solveUnderAssumptions(assumps, _uprOnly);
+  SATCallRecorder solveRec(*_solver, env.statistics->gsSatCalls);
+  SATSolver::Status res = solveRec.record(_solver->solveUnderAssumptions(assumps, _solveBudget.limit()));
 
   if (res == SATSolver::Status::UNSATISFIABLE) {
     // it should always be UNSAT with full assumps,
@@ -167,7 +251,7 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
 
     if (failed.size() < assumps.size()) {
       // proper subset sufficed for UNSAT - that's the interesting case
-      const SATLiteralStack& failedFinal = _explicitMinim ? _solver->explicitlyMinimizedFailedAssumptions(_uprOnly,_randomizeMinim) : failed;
+      const SATLiteralStack& failedFinal = _explicitMinim ? minimizeFailedAssumptions() : failed;
 
       static LiteralStack survivors;
       survivors.reset();
@@ -175,6 +259,10 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
       static Set<SATLiteral> splitAssumps;
       splitAssumps.reset();
 
+      // the split levels among the failed assumptions (only maintained with _namingSplitter)
+      static Set<SplitLevel> failedLevels;
+      failedLevels.reset();
+
       for (unsigned i = 0; i < failedFinal.size(); i++) {
         SATLiteral olit = failedFinal[i].opposite(); // back to the original polarity
 
@@ -183,6 +271,13 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
           survivors.push(lit);
         } else { // otherwise it was a split level assumption
           splitAssumps.insert(olit);
+
+          if (_namingSplitter) {
+            SplitLevel lev;
+            if (namedLevels.find(olit.opposite(),lev) || isSplitLevelVar(olit.var(),lev)) {
+              failedLevels.insert(lev);
+            }
+          }
         }
       }
 
@@ -197,6 +292,18 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
         prems.reset();
         prems.push(cl);
 
+        if (_namingSplitter) {
+          // a ground component's literal may come from clauses which do not depend on the component,
+          // so the dependency on its level is passed on to the replacement through the component itself
+          auto nit = namedLevels.items();
+          while (nit.hasNext()) {
+            auto item = nit.next();
+            if (failedLevels.contains(item.second)) {
+              prems.push(_namingSplitter->getComponentClause(item.second));
+            }
+          }
+        }
+
         SATInference::collectFilteredFOPremises(ref, prems,
           // Some solvers may return "all the clauses added so far" in the refutation.
           // That must be filtered since a derived clause cannot depend on inactive splits
@@ -209,6 +316,8 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
             }
 
             // and don't keep any premise which mentions an unassumed split level assumption
+            // (with shared naming, the literal of a named level may also be derived by propagation,
+            // so only the fresh split variables tell which premises were not used)
             unsigned prem_sz = prem->size();
             for (unsigned i = 0; i < prem_sz; i++ ) {
               SATLiteral lit = (*prem)[i];
@@ -223,6 +332,16 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
             return true;
           } );
 
+        if (_namingSplitter && !premisesActive(prems)) {
+          // a kept premise depends on a named level which is not active,
+          // so the replacement could not be conditioned on the current split sets
+          prems.reset();
+          if (_adaptiveBudget) {
+            _solveBudget.record(false, solveRec.conflicts());
+          }
+          return cl;
+        }
+
         UnitList* premList = 0;
         Stack<Unit*>::Iterator it(prems);
         while (it.hasNext()) {
@@ -246,14 +365,37 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
         env.statistics->globalSubsumption++;
         ASS_L(replacement->length(), clen);
 
+        if (_adaptiveBudget) {
+          _solveBudget.record(true, solveRec.conflicts());
+        }
         return replacement;
       }
     }
   }
 
+  if (_adaptiveBudget) {
+    _solveBudget.record(false, solveRec.conflicts());
+  }
   return cl;
 }
 
+/**
+ * Explicitly minimize the failed assumptions of the last (UNSAT) solver call.
+ */
+const SATLiteralStack& GlobalSubsumption::minimizeFailedAssumptions()
+{
+  unsigned before = _solver->failedAssumptions().size();
+
+  SATCallRecorder rec(*_solver, env.statistics->gsMinimizationSatCalls);
+  const SATLiteralStack& res = _solver->explicitlyMinimizedFailedAssumptions(_minimBudget.limit(),_randomizeMinim);
+  rec.record();
+
+  if (_adaptiveBudget) {
+    _minimBudget.record(res.size() < before, rec.conflicts());
+  }
+  return res;
+}
+
 /**
  * Functor that extracts a clause from UnitSpec.
  */
@@ -19,6 +19,7 @@
 #include "Shell/Options.hpp"
 #include "Kernel/Grounder.hpp"
 #include "SAT/SATSolver.hpp"
+#include "SAT/SATCallMonitoring.hpp"
 
 #include "InferenceEngine.hpp"
 
@@ -54,6 +55,18 @@ private:
    */
   bool _uprOnly;
 
+  /**
+   * Adapt the conflict limits below to the observed success of the calls.
+   */
+  bool _adaptiveBudget;
+
+  /**
+   * Conflict limits for the main solver call and for explicit minimization
+   * (0 with _uprOnly, unlimited unless _adaptiveBudget).
+   */
+  AdaptiveConflictBudget _solveBudget;
+  AdaptiveConflictBudget _minimBudget;
+
   /**
    * Explicitly minimize the obtained assumption set.
    */
@@ -76,6 +89,12 @@ private:
    */
   Splitter* _splitter;
 
+  /**
+   * The splitter whose ground components are named by their grounded literal
+   * in our SAT solver (see Options::globalSubsumptionSharedNaming), or 0.
+   */
+  Splitter* _namingSplitter;
+
   /**
    * A map binding split levels to variables assigned to them in our SAT solver.
    *
@@ -89,16 +108,14 @@ private:
   DHMap<unsigned, unsigned> _vars2splits;
 
 protected:
-  unsigned splitLevelToVar(SplitLevel lev) {
-    unsigned* pvar;
+  /**
+   * Return the SAT literal which is true iff split level @c lev is active.
+   */
+  SATLiteral splitLevelToLiteral(SplitLevel lev);
 
-    if(_splits2vars.getValuePtr(lev, pvar)) {
-      *pvar = _solver->newVar();
-      ALWAYS(_vars2splits.insert(*pvar,lev));
-    }
+  const SATLiteralStack& minimizeFailedAssumptions();
 
-    return *pvar;
-  }
+  bool premisesActive(const Stack<Unit*>& prems);
 
   bool isSplitLevelVar(unsigned var, SplitLevel& lev) {
     return _vars2splits.find(var,lev);
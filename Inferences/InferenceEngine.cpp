@@ -162,6 +162,14 @@ void CompositeISE::detach()
 //  ForwardSimplificationEngine::detach();
 //}
 
+ClauseIterator GeneratingInferenceEngine::collectPushedClauses(Clause* premise)
+{
+  Stack<Clause*> clauses;
+  auto sink = clauseSink([&](Clause* cl) { clauses.push(cl); });
+  pushClauses(premise, sink);
+  return pvi(arrayIter(std::move(clauses)));
+}
+
 struct GeneratingFunctor
 {
 
@@ -184,6 +192,13 @@ ClauseIterator CompositeGIE::generateClauses(Clause* premise)
   return pvi( getFlattenedIterator(
 	  getMappingIterator(GIList::Iterator(_inners), GeneratingFunctor(premise))) );
 }
+void CompositeGIE::pushClauses(Clause* premise, ClauseSink& sink)
+{
+  GIList::Iterator it(_inners);
+  while(it.hasNext()) {
+    it.next()->pushClauses(premise, sink);
+  }
+}
 void CompositeGIE::attach(SaturationAlgorithm* salg)
 {
   GeneratingInferenceEngine::attach(salg);
@@ -255,6 +270,21 @@ CompositeSGI::ClauseGenerationResult CompositeSGI::generateSimplify(Kernel::Clau
   };
 }
 
+bool CompositeSGI::pushGenerateSimplify(Clause* cl, ClauseSink& sink)
+{
+  /* apply generations as until a redundancy is discovered */
+  for (auto simpl : _simplifiers) {
+    if (simpl->pushGenerateSimplify(cl, sink)) {
+      return true;
+    }
+  }
+  /* apply strictly generating rules if there hasn't been a redundancy */
+  for (auto gen : _generators) {
+    gen->pushClauses(cl, sink);
+  }
+  return false;
+}
+
 CompositeSGI::~CompositeSGI() {
   for (auto gen : _generators) {
     delete gen;
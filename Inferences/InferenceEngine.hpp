@@ -88,6 +88,31 @@ protected:
   SaturationAlgorithm* _salg;
 };
 
+/**
+ * Receiver of the clauses produced by a generating inference,
+ * see GeneratingInferenceEngine::pushClauses.
+ */
+class ClauseSink
+{
+public:
+  virtual void add(Clause* cl) = 0;
+};
+
+template<class F>
+class ClauseSinkFn
+: public ClauseSink
+{
+public:
+  ClauseSinkFn(F f) : _f(std::move(f)) {}
+  void add(Clause* cl) override { _f(cl); }
+private:
+  F _f;
+};
+
+/** Return a ClauseSink calling @b f on each added clause */
+template<class F>
+ClauseSinkFn<F> clauseSink(F f) { return ClauseSinkFn<F>(std::move(f)); }
+
 /** A generating inference that might make its major premise redundant. */
 class SimplifyingGeneratingInference
 : public InferenceEngine
@@ -111,6 +136,20 @@ public:
    * as well as the information wether the premise was made redundant.
    */
   virtual ClauseGenerationResult generateSimplify(Clause* premise)  = 0;
+
+  /**
+   * Push-based variant of generateSimplify: pass the generated clauses
+   * to @b sink as soon as they are produced, and return true iff the
+   * premise was made redundant.
+   */
+  virtual bool pushGenerateSimplify(Clause* premise, ClauseSink& sink)
+  {
+    auto res = generateSimplify(premise);
+    while (res.clauses.hasNext()) {
+      sink.add(res.clauses.next());
+    }
+    return res.premiseRedundant;
+  }
 };
 
 
@@ -121,9 +160,35 @@ class GeneratingInferenceEngine
 public:
   virtual ClauseIterator generateClauses(Clause* premise) = 0;
 
+  /**
+   * Pass the clauses generated from @b premise to @b sink.
+   *
+   * The default implementation drains generateClauses(premise).
+   * Inferences producing many cheap conclusions override this to
+   * emit them without building an iterator pipeline, and implement
+   * generateClauses by collectPushedClauses.
+   */
+  virtual void pushClauses(Clause* premise, ClauseSink& sink)
+  {
+    auto it = generateClauses(premise);
+    while (it.hasNext()) {
+      sink.add(it.next());
+    }
+  }
+
   ClauseGenerationResult generateSimplify(Clause* premise) override
   { return { .clauses = generateClauses(premise), 
              .premiseRedundant = false, }; }
+
+  bool pushGenerateSimplify(Clause* premise, ClauseSink& sink) override
+  {
+    pushClauses(premise, sink);
+    return false;
+  }
+
+protected:
+  /** Return the clauses passed by pushClauses(premise) to its sink */
+  ClauseIterator collectPushedClauses(Clause* premise);
 };
 
 class ImmediateSimplificationEngine
@@ -270,12 +335,17 @@ struct BwSimplificationRecord
 {
   BwSimplificationRecord() {}
   BwSimplificationRecord(Clause* toRemove)
-  : toRemove(toRemove), replacement(0) {}
+  : toRemove(toRemove), replacement(0), premise(0) {}
   BwSimplificationRecord(Clause* toRemove, Clause* replacement)
-  : toRemove(toRemove), replacement(replacement) {}
+  : toRemove(toRemove), replacement(replacement), premise(0) {}
 
   Clause* toRemove;
   Clause* replacement;
+  /**
+   * The clause that simplified @b toRemove, if it is not the one
+   * passed to BackwardSimplificationEngine::perform (e.g. in batched sweeps)
+   */
+  Clause* premise;
 };
 typedef VirtualIterator<BwSimplificationRecord> BwSimplificationRecordIterator;
 
@@ -353,6 +423,7 @@ public:
   virtual ~CompositeGIE();
   void addFront(GeneratingInferenceEngine* fse);
   ClauseIterator generateClauses(Clause* premise) override;
+  void pushClauses(Clause* premise, ClauseSink& sink) override;
   void attach(SaturationAlgorithm* salg) override;
   void detach() override;
 private:
@@ -370,6 +441,7 @@ public:
   void push(SimplifyingGeneratingInference*);
   void push(GeneratingInferenceEngine*);
   ClauseGenerationResult generateSimplify(Clause* premise) override;
+  bool pushGenerateSimplify(Clause* premise, ClauseSink& sink) override;
   void attach(SaturationAlgorithm* salg) override;
   void detach() override;
 private:
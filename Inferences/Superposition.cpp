@@ -80,83 +80,53 @@ void Superposition::detach()
   GeneratingInferenceEngine::detach();
 }
 
-struct Superposition::ForwardResultFn
+void Superposition::pushClauses(Clause* premise, ClauseSink& sink)
 {
-  ForwardResultFn(Clause* cl, Superposition& parent) : _cl(cl), _parent(parent) {}
-  Clause* operator()(pair<pair<Literal*, TypedTermList>, QueryRes<AbstractingUnifier*, TermLiteralClause>> arg)
-  {
-    auto& qr = arg.second;
-    return _parent.performSuperposition(_cl, arg.first.first, arg.first.second,
-	    qr.data->clause, qr.data->literal, qr.data->term, qr.unifier, true);
-  }
-private:
-  Clause* _cl;
-  Superposition& _parent;
-};
+  TIME_TRACE("superposition");
 
+  auto uwa = env.options->unificationWithAbstraction();
+  auto fixedPointIteration = env.options->unificationWithAbstractionFixedPointIteration();
 
-struct Superposition::BackwardResultFn
-{
-  BackwardResultFn(Clause* cl, Superposition& parent) : _cl(cl), _parent(parent) {}
-  Clause* operator()(pair<pair<Literal*, TermList>, QueryRes<AbstractingUnifier*, TermLiteralClause>> arg)
-  {
-    if(_cl==arg.second.data->clause) {
-      return 0;
+  //Perform forward superposition
+  for (Literal* lit : premise->getSelectedLiteralIterator()) {
+    // the rewritable subterms (see EqHelper) of the literal are the non-variable
+    // subterms of either a maximal side of an equality or of a non-equational literal
+    auto subterms = env.options->combinatorySup() ? EqHelper::getFoSubtermIterator(lit, _salg->getOrdering())
+                                                  : EqHelper::getSubtermIterator(lit,  _salg->getOrdering());
+    while (subterms.hasNext()) {
+      TypedTermList rwTerm = subterms.next();
+      // clauses with a literal whose complement unifies with the rewritable subterm
+      auto unifs = _lhsIndex->getUwa(rwTerm, uwa, fixedPointIteration);
+      while (unifs.hasNext()) {
+        auto qr = unifs.next();
+        // null results can come from performSuperposition
+        if (auto res = performSuperposition(premise, lit, rwTerm,
+              qr.data->clause, qr.data->literal, qr.data->term, qr.unifier, true)) {
+          sink.add(res);
+        }
+      }
     }
-
-    auto& qr = arg.second;
-    return _parent.performSuperposition(qr.data->clause, qr.data->literal, qr.data->term,
-	    _cl, arg.first.first, arg.first.second, qr.unifier, false);
   }
-private:
-  Clause* _cl;
-  Superposition& _parent;
-};
-
-
-ClauseIterator Superposition::generateClauses(Clause* premise)
-{
-  auto itf1 = premise->getSelectedLiteralIterator();
-
-  // Get an iterator of pairs of selected literals and rewritable subterms of those literals
-  // A subterm is rewritable (see EqHelper) if it is a non-variable subterm of either
-  // a maximal side of an equality or of a non-equational literal
-  auto itf2 = getMapAndFlattenIterator(itf1,
-      [this](Literal* lit)
-      // returns an iterator over the rewritable subterms
-      { return pushPairIntoRightIterator(lit, env.options->combinatorySup() ? EqHelper::getFoSubtermIterator(lit, _salg->getOrdering())
-                                                                            : EqHelper::getSubtermIterator(lit,  _salg->getOrdering())); });
-
-  // Get clauses with a literal whose complement unifies with the rewritable subterm,
-  // returns a pair with the original pair and the unification result (includes substitution)
-  auto itf3 = getMapAndFlattenIterator(itf2,
-      [this](pair<Literal*, TypedTermList> arg)
-      { return pushPairIntoRightIterator(arg, _lhsIndex->getUwa(arg.second, env.options->unificationWithAbstraction(), env.options->unificationWithAbstractionFixedPointIteration())); });
-
-  //Perform forward superposition
-  auto itf4 = getMappingIterator(itf3,ForwardResultFn(premise, *this));
-
-  auto itb1 = premise->getSelectedLiteralIterator();
-  auto itb2 = getMapAndFlattenIterator(itb1,EqHelper::SuperpositionLHSIteratorFn(_salg->getOrdering(), _salg->getOptions()));
-  auto itb3 = getMapAndFlattenIterator(itb2,
-      [this] (pair<Literal*, TermList> arg)
-      { return pushPairIntoRightIterator(
-              arg,
-              _subtermIndex->getUwa(TypedTermList(arg.second, SortHelper::getEqualityArgumentSort(arg.first)), env.options->unificationWithAbstraction(), env.options->unificationWithAbstractionFixedPointIteration())); });
 
   //Perform backward superposition
-  auto itb4 = getMappingIterator(itb3,BackwardResultFn(premise, *this));
-
-  // Add the results of forward and backward together
-  auto it5 = concatIters(itf4,itb4);
-
-  // Remove null elements - these can come from performSuperposition
-  auto it6 = getFilteredIterator(it5,NonzeroFn());
-
-  // The outer iterator ensures we update the time counter for superposition
-  auto it7 = TIME_TRACE_ITER("superposition", it6);
-
-  return pvi( it7 );
+  EqHelper::SuperpositionLHSIteratorFn lhsFn(_salg->getOrdering(), _salg->getOptions());
+  for (Literal* lit : premise->getSelectedLiteralIterator()) {
+    auto lhss = lhsFn(lit);
+    while (lhss.hasNext()) {
+      TermList eqLHS = lhss.next().second;
+      auto unifs = _subtermIndex->getUwa(TypedTermList(eqLHS, SortHelper::getEqualityArgumentSort(lit)), uwa, fixedPointIteration);
+      while (unifs.hasNext()) {
+        auto qr = unifs.next();
+        if (premise == qr.data->clause) {
+          continue;
+        }
+        if (auto res = performSuperposition(qr.data->clause, qr.data->literal, qr.data->term,
+              premise, lit, eqLHS, qr.unifier, false)) {
+          sink.add(res);
+        }
+      }
+    }
+  }
 }
 
 /**
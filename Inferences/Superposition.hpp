@@ -36,7 +36,9 @@ public:
   void attach(SaturationAlgorithm* salg);
   void detach();
 
-  ClauseIterator generateClauses(Clause* premise);
+  ClauseIterator generateClauses(Clause* premise) override
+  { return collectPushedClauses(premise); }
+  void pushClauses(Clause* premise, ClauseSink& sink) override;
 
 
 private:
@@ -60,12 +62,6 @@ private:
   }
 #endif
 
-  struct ForwardResultFn;
-
-  struct LHSsFn;
-  struct RewritableResultsFn;
-  struct BackwardResultFn;
-
   SuperpositionSubtermIndex* _subtermIndex;
   SuperpositionLHSIndex* _lhsIndex;
 };
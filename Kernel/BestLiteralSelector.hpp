@@ -238,7 +238,7 @@ protected:
       Literal* lit=rlit.next();
       LiteralList::push(lit,maximals);
     }
-    _ord.removeNonMaximal(maximals);
+    removeNonMaximal(maximals);
   }
 
 private:
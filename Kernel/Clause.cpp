@@ -71,6 +71,7 @@ Clause::Clause(Literal* const* lits, unsigned length, Inference inf)
     _extensionality(false),
     _extensionalityTag(false),
     _component(false),
+    _frozen(false),
     _store(NONE),
     _numSelected(0),
     _weight(0),
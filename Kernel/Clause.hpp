@@ -223,6 +223,13 @@ public:
   bool isComponent() const { return _component; }
   void setComponent(bool c) { _component = c; }
 
+  /**
+   * The clause was taken out of the active set by AVATAR but kept in the
+   * generating indices, whose retrievals skip it (see ActiveClauseContainer::freeze).
+   */
+  bool isFrozen() const { return _frozen; }
+  void setFrozen(bool f) { _frozen = f; }
+
   bool skip() const;
 
   unsigned getLiteralPosition(Literal* lit);
@@ -392,6 +399,8 @@ protected:
   unsigned _extensionalityTag : 1;
   /** Clause is a splitting component. */
   unsigned _component : 1;
+  /** Clause is frozen, see isFrozen() */
+  unsigned _frozen : 1;
 
   /** storage class */
   Store _store : 3;
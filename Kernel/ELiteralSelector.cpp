@@ -33,7 +33,7 @@ LiteralList* ELiteralSelector::getMaximalsInOrder(Clause* c, unsigned eligible)
     LiteralList::push((*c)[li],res);
   }
 
-  _ord.removeNonMaximal(res);
+  removeNonMaximal(res);
 
   return res;
 }
@@ -41,6 +41,11 @@ public:
    */
   void groundNonProp(Clause* cl, SATLiteralStack& acc);
 
+  /**
+   * Return SATLiteral corresponding to @c lit.
+   */
+  SATLiteral groundLiteral(Literal* lit);
+
 private:
   /**
    * Normalize literals before grounding.
@@ -49,11 +54,6 @@ private:
    */
   void normalize(unsigned cnt, Literal** lits);
 
-  /**
-   * Return SATLiteral corresponding to @c lit.
-   */
-  SATLiteral groundLiteral(Literal* lit);
-
   /**
    * Return SATLiteral corresponding to @c lit.
    */
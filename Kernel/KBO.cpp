@@ -108,7 +108,12 @@ void KBO::State::recordVariable(unsigned var)
   static_assert(coef==1 || coef==-1);
 
   int* pnum;
-  _varDiffs.getValuePtr(var,pnum,0);
+  if (var < SMALL_VARS) {
+    _smallVarsUsed |= uint64_t(1) << var;
+    pnum = &_smallVarDiffs[var];
+  } else {
+    _varDiffs.getValuePtr(var,pnum,0);
+  }
   (*pnum)+=coef;
   if constexpr (coef==1) {
     if(*pnum==0) {
@@ -771,7 +776,7 @@ Ordering::Result KBO::comparePredicates(Literal* l1, Literal* l2) const
 
 Ordering::Result KBO::compare(TermList tl1, TermList tl2) const
 {
-  return compare(AppliedTerm(tl1),AppliedTerm(tl2));
+  return compareGroundCached(tl1, tl2, [&]() { return compare(AppliedTerm(tl1),AppliedTerm(tl2)); });
 }
 
 Ordering::Result KBO::compare(AppliedTerm tl1, AppliedTerm tl2) const
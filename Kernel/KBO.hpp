@@ -201,7 +201,15 @@ private:
   class State
   {
     int _weightDiff;
-    /** The variable counters */
+    /**
+     * Counters of variables below @b SMALL_VARS, which are most of the variables
+     * in practice, so that we do not have to hash them
+     */
+    static constexpr unsigned SMALL_VARS = 64;
+    int _smallVarDiffs[SMALL_VARS];
+    /** Bitmask of the counters in @b _smallVarDiffs that may be non-zero */
+    uint64_t _smallVarsUsed;
+    /** The counters of the other variables */
     DHMap<unsigned, int, IdentityHash, DefaultHash> _varDiffs;
     /** Number of variables, that occur more times in the first literal */
     int _posNum;
@@ -211,7 +219,10 @@ private:
     Result _lexResult;
   public:
     /** Initialise the state */
-    State() {}
+    State() : _smallVarsUsed(0)
+    {
+      std::fill(_smallVarDiffs, _smallVarDiffs+SMALL_VARS, 0);
+    }
 
     void init()
     {
@@ -219,9 +230,30 @@ private:
       _posNum=0;
       _negNum=0;
       _lexResult=EQUAL;
+      while (_smallVarsUsed) {
+        _smallVarDiffs[__builtin_ctzll(_smallVarsUsed)] = 0;
+        _smallVarsUsed &= _smallVarsUsed-1;
+      }
       _varDiffs.reset();
     }
 
+    /** Call @b fn on each variable and its counter, some of which may be zero */
+    template<class Fn>
+    void forEachVarDiff(Fn fn) const
+    {
+      for (uint64_t used = _smallVarsUsed; used; used &= used-1) {
+        unsigned var = __builtin_ctzll(used);
+        fn(var, _smallVarDiffs[var]);
+      }
+      decltype(_varDiffs)::Iterator vit(_varDiffs);
+      while (vit.hasNext()) {
+        unsigned var;
+        int cnt;
+        vit.next(var, cnt);
+        fn(var, cnt);
+      }
+    }
+
     /**
      * Lexicographic traversal of two terms with same top symbol,
      * i.e. traversing their symbols in lockstep, as descibed in
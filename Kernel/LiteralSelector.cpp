@@ -70,6 +70,38 @@ int LiteralSelector::getSelectionPriority(Literal* l) const
   return 0;
 }
 
+/**
+ * Compare literals @b l1 and @b l2 in the ordering of the selector,
+ * reusing the result of an earlier comparison of the same pair
+ */
+Ordering::Result LiteralSelector::compareLiterals(Literal* l1, Literal* l2) const
+{
+  if(l2 < l1) {
+    return Ordering::reverse(compareLiterals(l2, l1));
+  }
+  if(_literalComparisons.size() > 65536) {
+    _literalComparisons.reset();
+  }
+  Ordering::Result* res;
+  if(_literalComparisons.getValuePtr(std::make_pair(l1, l2), res)) {
+    *res = _ord.compare(l1, l2);
+  }
+  ASS_EQ(*res, _ord.compare(l1, l2));
+  return *res;
+}
+
+/**
+ * Remove non-maximal literals from the list @b lits. The order
+ * of remaining literals stays unchanged.
+ *
+ * Like Ordering::removeNonMaximal, but goes through the comparison
+ * cache of the selector.
+ */
+void LiteralSelector::removeNonMaximal(LiteralList*& lits) const
+{
+  Ordering::removeNonMaximal(lits, [this](Literal* l1, Literal* l2) { return compareLiterals(l1, l2); });
+}
+
 /**
  * Return a literal selector object corresponding to number @b num
  *
@@ -21,7 +21,9 @@
 #include "Lib/Array.hpp"
 
 #include "Lib/Allocator.hpp"
+#include "Lib/DHMap.hpp"
 
+#include "Ordering.hpp"
 #include "Term.hpp"
 
 namespace Kernel {
@@ -100,6 +102,8 @@ protected:
    */
   virtual void doSelection(Clause* c, unsigned eligible) = 0;
 
+  void removeNonMaximal(LiteralList*& lits) const;
+
   const Ordering& _ord;
   const Options& _opt;
 private:
@@ -110,6 +114,16 @@ private:
    * @see isPositiveForSelection
    */
   bool _reversePolarity;
+
+  Ordering::Result compareLiterals(Literal* l1, Literal* l2) const;
+
+  /**
+   * Results of literal comparisons done during selection, keyed by
+   * the pair of compared literals. Literals are shared, so a clause
+   * reselected after simplification, or any other clause containing
+   * the same pair, gets the comparison for free.
+   */
+  mutable DHMap<std::pair<Literal*,Literal*>, Ordering::Result> _literalComparisons;
 };
 
 /**
@@ -183,23 +183,50 @@ Literal* LookaheadLiteralSelector::pickTheBest(Literal** lits, unsigned cnt)
   ASS_G(cnt,1); //special cases are handled elsewhere
 
   static DArray<VirtualIterator<std::tuple<>> > runifs; //resolution unification iterators
+  static DArray<unsigned> known; //inference counts reused from earlier selections
   runifs.ensure(cnt);
+  known.ensure(cnt);
+
+  _selections++;
+  if(_counts.size() > 65536) {
+    _counts.reset();
+  }
 
   for(unsigned i=0;i<cnt;i++) {
-    runifs[i]=getGeneraingInferenceIterator(lits[i]);
+    std::pair<unsigned,unsigned> cached;
+    if(_countReuse && _counts.find(lits[i], cached) &&
+       _selections - cached.second <= _countReuse) {
+      known[i]=cached.first;
+      runifs[i]=VirtualIterator<std::tuple<>>::getEmpty();
+    }
+    else {
+      known[i]=UINT_MAX;
+      runifs[i]=getGeneraingInferenceIterator(lits[i]);
+    }
   }
 
   static Stack<Literal*> candidates;
   candidates.reset();
+  unsigned round=0;
   do {
     for(unsigned i=0;i<cnt;i++) {
-      if(runifs[i].hasNext()) {
+      if(known[i]!=UINT_MAX) {
+	if(known[i]==round) {
+	  candidates.push(lits[i]);
+	}
+      }
+      else if(runifs[i].hasNext()) {
 	runifs[i].next();
       }
       else {
 	candidates.push(lits[i]);
+	if(_countReuse) {
+	  //the iterator ran out, so we know the exact count
+	  _counts.set(lits[i], std::make_pair(round, _selections));
+	}
       }
     }
+    round++;
   } while(candidates.isEmpty());
 
   using namespace LiteralComparators;
@@ -280,7 +307,7 @@ void LookaheadLiteralSelector::doSelection(Clause* c, unsigned eligible)
       Literal* lit=(*c)[li];
       LiteralList::push(lit,maximals);
     }
-    _ord.removeNonMaximal(maximals);
+    removeNonMaximal(maximals);
     ASS(maximals);
     if(selectable.isEmpty()) {
       //there are no negative literals, so we have to select all positive anyway
@@ -30,6 +30,8 @@ public:
   {
     _delay = options.lookaheadDelay();
     _skipped = 0;
+    _countReuse = options.lookaheadCountReuse();
+    _selections = 0;
     _startupSelector = (_delay==0) ? 0 : LiteralSelector::getSelector(ordering, options, completeSelection ? 10 : 1010);
   }
 
@@ -54,6 +56,16 @@ private:
   LiteralSelector* _startupSelector;
   int _delay;
   int _skipped;
+
+  /** For how many selections may a counted number of inferences be reused */
+  unsigned _countReuse;
+  /** Number of selections done by pickTheBest, used to time out counts */
+  unsigned _selections;
+  /**
+   * Number of inferences found for a literal, paired with the value of
+   * @b _selections when it was counted
+   */
+  DHMap<Literal*, std::pair<unsigned,unsigned>> _counts;
 };
 
 }
@@ -44,7 +44,7 @@ void MaximalLiteralSelector::doSelection(Clause* c, unsigned eligible)
     }
   }
 
-  _ord.removeNonMaximal(sel);
+  removeNonMaximal(sel);
 
   Literal* singleSel=0;
 
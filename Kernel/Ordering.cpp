@@ -32,6 +32,7 @@
 #include "Shell/Options.hpp"
 #include "Shell/Property.hpp"
 #include "Shell/Shuffling.hpp"
+#include "Shell/Statistics.hpp"
 
 #include "LPO.hpp"
 #include "KBO.hpp"
@@ -211,32 +212,6 @@ const char* Ordering::resultToString(Result r)
   }
 }
 
-/**
- * Remove non-maximal literals from the list @b lits. The order
- * of remaining literals stays unchanged.
- */
-void Ordering::removeNonMaximal(LiteralList*& lits) const
-{
-  LiteralList** ptr1 = &lits;
-  while (*ptr1) {
-    LiteralList** ptr2 = &(*ptr1)->tailReference();
-    while (*ptr2 && *ptr1) {
-      Ordering::Result res = compare((*ptr1)->head(), (*ptr2)->head());
-
-      if (res == Ordering::GREATER || res == Ordering::EQUAL) {
-        LiteralList::pop(*ptr2);
-        continue;
-      } else if (res == Ordering::LESS) {
-        LiteralList::pop(*ptr1);
-        goto topLevelContinue;
-      }
-      ptr2 = &(*ptr2)->tailReference();
-    }
-    ptr1 = &(*ptr1)->tailReference();
-    topLevelContinue: ;
-  }
-}
-
 Ordering::Result Ordering::getEqualityArgumentOrder(Literal* eq) const
 {
   ASS(eq->isEquality());
@@ -708,6 +683,39 @@ PrecedenceOrdering::PrecedenceOrdering(Problem& prb, const Options& opt, const D
     qkboPrecedence
     )
 {
+  if (opt.groundOrderingCache()) {
+    _groundCache.init(1u << opt.groundOrderingCache());
+  }
+}
+
+PrecedenceOrdering::GroundCacheEntry& PrecedenceOrdering::groundCacheEntry(Term* s, Term* t) const
+{
+  ASS_EQ(_groundCache.size() & (_groundCache.size()-1), 0);
+  return _groundCache[HashUtils::combine(s->getId(), t->getId()) & (_groundCache.size()-1)];
+}
+
+/**
+ * Look up the result of comparing ground terms @b s and @b t in the cache,
+ * return true and assign it to @b res if it is there.
+ */
+bool PrecedenceOrdering::lookupGround(Term* s, Term* t, Result& res) const
+{
+  GroundCacheEntry& e = groundCacheEntry(s, t);
+  if (e.s != s || e.t != t) {
+    env.statistics->groundOrderingCacheMisses++;
+    return false;
+  }
+  env.statistics->groundOrderingCacheHits++;
+  res = e.res;
+  return true;
+}
+
+void PrecedenceOrdering::storeGround(Term* s, Term* t, Result res) const
+{
+  GroundCacheEntry& e = groundCacheEntry(s, t);
+  e.s = s;
+  e.t = t;
+  e.res = res;
 }
 
 /**
@@ -24,6 +24,7 @@
 #include "Lib/Comparison.hpp"
 #include "Lib/SmartPtr.hpp"
 #include "Lib/DArray.hpp"
+#include "Lib/List.hpp"
 #include "Kernel/Term.hpp"
 
 #include "Lib/Allocator.hpp"
@@ -110,7 +111,35 @@ public:
 
   static bool isGreaterOrEqual(Result r) { return (r == GREATER || r == EQUAL); }
 
-  void removeNonMaximal(LiteralList*& lits) const;
+  void removeNonMaximal(LiteralList*& lits) const
+  { removeNonMaximal(lits, [this](Literal* l1, Literal* l2) { return compare(l1, l2); }); }
+
+  /**
+   * Remove literals that are not maximal w.r.t. @b cmp from the list @b lits.
+   * The order of remaining literals stays unchanged.
+   */
+  template<class Compare>
+  static void removeNonMaximal(LiteralList*& lits, Compare cmp)
+  {
+    LiteralList** ptr1 = &lits;
+    while (*ptr1) {
+      LiteralList** ptr2 = &(*ptr1)->tailReference();
+      while (*ptr2 && *ptr1) {
+        Result res = cmp((*ptr1)->head(), (*ptr2)->head());
+
+        if (res == GREATER || res == EQUAL) {
+          LiteralList::pop(*ptr2);
+          continue;
+        } else if (res == LESS) {
+          LiteralList::pop(*ptr1);
+          goto topLevelContinue;
+        }
+        ptr2 = &(*ptr2)->tailReference();
+      }
+      ptr1 = &(*ptr1)->tailReference();
+      topLevelContinue: ;
+    }
+  }
 
   static Result fromComparison(Comparison c);
   static Comparison intoComparison(Result c);
@@ -202,6 +231,37 @@ protected:
 
   int predicateLevel(unsigned pred) const;
 
+  /**
+   * Return the result of @b compute(), which compares @b tl1 and @b tl2,
+   * looking it up in the ground comparison cache first if both are ground
+   * terms. As ground terms are shared, the result for a pair of them never
+   * changes, so we can keep it under their addresses.
+   */
+  template<class Compute>
+  Result compareGroundCached(TermList tl1, TermList tl2, Compute compute) const
+  {
+    if (!_groundCache.size() || !tl1.isTerm() || !tl2.isTerm()) {
+      return compute();
+    }
+    Term* s = tl1.term();
+    Term* t = tl2.term();
+    if (s == t || !s->shared() || !t->shared() || !s->ground() || !t->ground()) {
+      return compute();
+    }
+    // both orientations of a pair share the entry
+    bool swap = s > t;
+    if (swap) {
+      std::swap(s, t);
+    }
+    Result res;
+    if (lookupGround(s, t, res)) {
+      return swap ? reverse(res) : res;
+    }
+    res = compute();
+    storeGround(s, t, swap ? reverse(res) : res);
+    return res;
+  }
+
   /** number of predicates in the signature at the time the order was created */
   unsigned _predicates;
   /** number of functions in the signature at the time the order was created */
@@ -219,6 +279,19 @@ protected:
 
   bool _reverseLCM;
   bool _qkboPrecedence;
+
+private:
+  struct GroundCacheEntry {
+    Term* s = nullptr;
+    Term* t = nullptr;
+    Result res;
+  };
+  GroundCacheEntry& groundCacheEntry(Term* s, Term* t) const;
+  bool lookupGround(Term* s, Term* t, Result& res) const;
+  void storeGround(Term* s, Term* t, Result res) const;
+
+  /** direct-mapped cache of comparisons of ground terms, empty if disabled */
+  mutable DArray<GroundCacheEntry> _groundCache;
 };
 
 
@@ -39,7 +39,7 @@ using namespace Kernel;
  * The new object takes ownership of the list @c units.
  */
 Problem::Problem(UnitList* units)
-: _units(0), _fnDefHandler(new FunctionDefinitionHandler()), _smtlibLogic(SMTLIBLogic::UNDEFINED), _property(0)
+: _units(0), _fnDefHandler(new FunctionDefinitionHandler()), _smtlibLogic(SMTLIBLogic::UNDEFINED), _property(0), _sineIndex(0)
 {
   initValues();
 
@@ -53,7 +53,7 @@ Problem::Problem(UnitList* units)
  * clauses in the iterator.
  */
 Problem::Problem(ClauseIterator clauses, bool copy)
-: _units(0), _fnDefHandler(new FunctionDefinitionHandler()), _property(0)
+: _units(0), _fnDefHandler(new FunctionDefinitionHandler()), _property(0), _sineIndex(0)
 {
   initValues();
 
@@ -188,6 +188,7 @@ void Problem::copyInto(Problem& tgt, bool copyClauses)
     tgt._property = _property;
     tgt.readDetailsFromProperty();
   }
+  tgt._sineIndex = _sineIndex;
 
   //TODO copy the deleted maps
 }
@@ -85,6 +85,13 @@ public:
   DHMap<unsigned,Unit*> getEliminatedPredicates(){ return _deletedPredicates; }
   DHMap<unsigned,Unit*> getPartiallyEliminatedPredicates(){ return _partiallyDeletedPredicates;}
   FunctionDefinitionHandler& getFunctionDefinitionHandler(){ return *_fnDefHandler; }
+
+  /**
+   * SInE index to be shared by all the SInE selections on this problem (or 0).
+   * Not owned by the problem; typically built by the portfolio parent before forking.
+   */
+  SineIndex* sineIndex() const { return _sineIndex; }
+  void setSineIndex(SineIndex* index) { _sineIndex = index; }
   
 
   bool isPropertyUpToDate() const { return _propertyValid; }
@@ -226,6 +233,8 @@ private:
 
   mutable bool _propertyValid;
   mutable Property* _property;
+
+  SineIndex* _sineIndex;
 };
 
 }
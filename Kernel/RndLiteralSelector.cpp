@@ -34,7 +34,7 @@ LiteralList* RndLiteralSelector::getMaximalsInOrder(Clause* c, unsigned eligible
     LiteralList::push((*c)[li],res);
   }
 
-  _ord.removeNonMaximal(res);
+  removeNonMaximal(res);
 
   return res;
 }
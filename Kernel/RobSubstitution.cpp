@@ -156,18 +156,18 @@ TermSpec const& RobSubstitution::derefBound(TermSpec const& t_) const
   }
 }
 
-template<class T, class H1, class H2>
-void RobSubstitution::bind(DHMap<VarSpec, T, H1, H2>& map, const VarSpec& v, T b)
+/**
+ * If recording, make backtracking undo all bindings made since
+ * the binding trail had size @b trailSize.
+ */
+void RobSubstitution::undoBindingsOnBacktrack(unsigned trailSize)
 {
-  if(bdIsRecording()) {
-    ASS(map.find(v).isNone());
-    bdAdd(BacktrackObject::fromClosure([this, v, &map](){
-      map.remove(v);
+  if(bdIsRecording() && _bindings.trailSize() > trailSize) {
+    bdAdd(BacktrackObject::fromClosure([this, trailSize](){
+      _bindings.undoTo(trailSize);
       _applyMemo.reset();
     }));
   }
-  map.set(v,std::move(b));
-  _applyMemo.reset();
 }
 
 
@@ -225,7 +225,10 @@ void RobSubstitution::bind(const VarSpec& v, TermSpec b)
   //ASS(!b.term.isTerm() || b.index!=AUX_INDEX || b.term.term()->shared());
   ASS_NEQ(v.index, UNBOUND_INDEX);
 
-  bind(_bindings, v, std::move(b));
+  unsigned trailSize = _bindings.trailSize();
+  _bindings.set(v, std::move(b));
+  _applyMemo.reset();
+  undoBindingsOnBacktrack(trailSize);
 }
 
 void RobSubstitution::bindVar(const VarSpec& var, const VarSpec& to)
@@ -273,8 +276,10 @@ bool RobSubstitution::unify(TermSpec s, TermSpec t)
     return true;
   }
 
-  BacktrackData localBD;
-  bdRecord(localBD);
+  // bindings made here are undone through the trail, so that
+  // we do not need a backtrack object for each of them
+  unsigned trailSize = _bindings.trailSize();
+  bdDoNotRecord();
 
   static Stack<pair<TermSpec, TermSpec>> toDo(64);
   ASS(toDo.isEmpty());
@@ -345,12 +350,10 @@ bool RobSubstitution::unify(TermSpec s, TermSpec t)
   bdDone();
 
   if(mismatch) {
-    localBD.backtrack();
+    _bindings.undoTo(trailSize);
+    _applyMemo.reset();
   } else {
-    if(bdIsRecording()) {
-      bdCommit(localBD);
-    }
-    localBD.drop();
+    undoBindingsOnBacktrack(trailSize);
   }
 
   DEBUG_UNIFY(0, *this)
@@ -373,8 +376,8 @@ bool RobSubstitution::match(TermSpec base, TermSpec instance)
   }
 
   bool mismatch=false;
-  BacktrackData localBD;
-  bdRecord(localBD);
+  unsigned trailSize = _bindings.trailSize();
+  bdDoNotRecord();
 
   static Stack<TermList*> subterms(64);
   ASS(subterms.isEmpty());
@@ -461,12 +464,10 @@ bool RobSubstitution::match(TermSpec base, TermSpec instance)
 
 
   if(mismatch) {
-    localBD.backtrack();
+    _bindings.undoTo(trailSize);
+    _applyMemo.reset();
   } else {
-    if(bdIsRecording()) {
-      bdCommit(localBD);
-    }
-    localBD.drop();
+    undoBindingsOnBacktrack(trailSize);
   }
 
   return !mismatch;
@@ -280,6 +280,93 @@ public:
 
 using namespace Lib;
 
+/**
+ * Variable bindings of a RobSubstitution.
+ *
+ * Ordinary variables of the first few variable banks, which are the
+ * ones used by unification in indices and inferences, are stored in
+ * dense arrays indexed by the variable number. All other variables
+ * (special and glue variables, other banks) are kept in a hash map.
+ * Every binding is recorded on a trail, so that bindings can be
+ * undone back to an earlier trail position, and the arrays keep their
+ * capacity on reset, so no memory is allocated in steady state.
+ */
+class RobBindings
+{
+  static constexpr int DENSE_BANKS = 4;
+  static constexpr unsigned DENSE_VARS = 1024;
+
+  /** entries with an empty term are unbound */
+  Stack<TermSpec> _dense[DENSE_BANKS];
+  DHMap<VarSpec, TermSpec> _sparse;
+  /** bound variables in the order in which they were bound */
+  Stack<VarSpec> _trail;
+
+  static bool isDense(VarSpec const& v)
+  { return v.index >= 0 && v.index < DENSE_BANKS && !v.special() && v.var() < DENSE_VARS; }
+
+  void unbind(VarSpec const& v)
+  {
+    if (isDense(v)) {
+      _dense[v.index][v.var()] = TermSpec();
+    } else {
+      ALWAYS(_sparse.remove(v));
+    }
+  }
+
+public:
+  Option<TermSpec const&> find(VarSpec const& v) const
+  {
+    if (isDense(v)) {
+      auto& bank = _dense[v.index];
+      return someIf(v.var() < bank.size() && bank[v.var()].term.isNonEmpty(),
+          [&]() -> TermSpec const& { return bank[v.var()]; });
+    }
+    return _sparse.find(v);
+  }
+
+  /** Bind the unbound variable @b v to @b t */
+  void set(VarSpec const& v, TermSpec t)
+  {
+    ASS(find(v).isNone());
+    ASS(t.term.isNonEmpty());
+    if (isDense(v)) {
+      auto& bank = _dense[v.index];
+      while (bank.size() <= v.var()) {
+        bank.push(TermSpec());
+      }
+      bank[v.var()] = std::move(t);
+    } else {
+      _sparse.insert(v, std::move(t));
+    }
+    _trail.push(v);
+  }
+
+  unsigned trailSize() const { return _trail.size(); }
+
+  /** Undo the bindings made since the trail had size @b size */
+  void undoTo(unsigned size)
+  {
+    while (_trail.size() > size) {
+      unbind(_trail.pop());
+    }
+  }
+
+  void reset() { undoTo(0); }
+  unsigned size() const { return _trail.size(); }
+  bool keepRecycled() const { return _trail.keepRecycled() || _sparse.keepRecycled(); }
+
+  friend std::ostream& operator<<(std::ostream& out, RobBindings const& self)
+  {
+    out << "{ ";
+    for (unsigned i = 0; i < self._trail.size(); i++) {
+      auto& v = self._trail[i];
+      out << (i == 0 ? "" : ", ") << v << " -> " << *self.find(v);
+    }
+    return out << " }";
+  }
+};
+
 class AbstractingUnifier;
 class UnificationConstraint;
 
@@ -289,7 +376,7 @@ class RobSubstitution
   friend class AbstractingUnifier;
   friend class UnificationConstraint;
  
-  DHMap<VarSpec, TermSpec> _bindings;
+  RobBindings _bindings;
   mutable DHMap<VarSpec, unsigned> _outputVarBindings;
   mutable bool _startedBindingOutputVars;
   mutable unsigned _nextUnboundAvailable;
@@ -456,9 +543,8 @@ private:
   RobSubstitution(const RobSubstitution& obj) = delete;
   RobSubstitution& operator=(const RobSubstitution& obj) = delete;
 
-  template<class T, class H1, class H2>
-  void bind(DHMap<VarSpec, T, H1, H2>& map, const VarSpec& v, T b);
   void bind(const VarSpec& v, TermSpec b);
+  void undoBindingsOnBacktrack(unsigned trailSize);
   void bindVar(const VarSpec& var, const VarSpec& to);
   bool match(TermSpec base, TermSpec instance);
   bool unify(TermSpec t1, TermSpec t2);
@@ -33,7 +33,7 @@ LiteralList* SpassLiteralSelector::getMaximalsInOrder(Clause* c, unsigned eligib
     LiteralList::push((*c)[li],res);
   }
 
-  _ord.removeNonMaximal(res);
+  removeNonMaximal(res);
 
   return res;
 }
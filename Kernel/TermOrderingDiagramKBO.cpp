@@ -35,12 +35,8 @@ void TermOrderingDiagramKBO::processTermNode()
   auto __state = std::move(kbo._state);
 #endif
   auto w = state->_weightDiff;
-  decltype(state->_varDiffs)::Iterator vit(state->_varDiffs);
   Stack<VarCoeffPair> nonzeros;
-  while (vit.hasNext()) {
-    unsigned v;
-    int cnt;
-    vit.next(v,cnt);
+  state->forEachVarDiff([&](unsigned v, int cnt) {
     if (cnt!=0) {
       nonzeros.push({ v, cnt });
       w-=cnt; // we have to remove the variable weights from w
@@ -48,7 +44,7 @@ void TermOrderingDiagramKBO::processTermNode()
     if (cnt<0) {
       varInbalance = true;
     }
-  }
+  });
 #if VDEBUG
   kbo._state = std::move(__state);
 #endif
@@ -27,6 +27,7 @@
 #include "Kernel/QKbo.hpp"
 #include <functional>
 #include "Debug/TimeProfiling.hpp"
+#include "Shell/Statistics.hpp"
 
 
 #include "Forwards.hpp"
@@ -1183,10 +1184,92 @@ AbstractionOracle::AbstractionResult uwa_floor(AbstractingUnifier& au, TermSpec
 }
 
 
+namespace {
+
+/**
+ * A stored result of AbstractionOracle::computeAbstraction
+ * for a pair of ground terms.
+ */
+struct CachedAbstraction {
+  enum { NOT_APPLICABLE, NEVER_EQUAL, EQUAL_IF } kind;
+  Stack<UnificationConstraint> unify;
+  Stack<UnificationConstraint> constr;
+};
+
+bool isGround(Stack<UnificationConstraint> const& cs)
+{
+  return iterTraits(cs.iter())
+    .all([](auto& c) { return c.lhs().definitelyGround() && c.rhs().definitelyGround(); });
+}
+
+} // namespace
+
+/**
+ * Results of abstraction are memoised for pairs of ground terms, for which
+ * they do not depend on the substitution of the unifier. Results that refer to
+ * non-ground terms (e.g. glue variables of the unifier) are not stored.
+ */
 Option<AbstractionOracle::AbstractionResult> AbstractionOracle::tryAbstract(AbstractingUnifier* au, TermSpec const& t1, TermSpec const& t2) const
 {
   ASS(_mode != Shell::Options::UnificationWithAbstraction::OFF)
 
+  static DHMap<std::tuple<unsigned, const Term*, const Term*>, CachedAbstraction> cache;
+  static const unsigned CACHE_LIMIT = 1 << 16;
+
+  env.statistics->uwaAbstractionAttempts++;
+
+  bool cacheable = t1.definitelyGround() && t2.definitelyGround();
+  auto key = std::make_tuple(unsigned(_mode), cacheable ? t1.term.term() : nullptr, cacheable ? t2.term.term() : nullptr);
+  Option<AbstractionResult> res;
+  if (cacheable && cache.find(key)) {
+    auto cached = &cache.get(key);
+    env.statistics->uwaAbstractionCacheHits++;
+    switch (cached->kind) {
+      case CachedAbstraction::NOT_APPLICABLE:
+        break;
+      case CachedAbstraction::NEVER_EQUAL:
+        res = some(AbstractionResult(NeverEqual{}));
+        break;
+      case CachedAbstraction::EQUAL_IF:
+        res = some(AbstractionResult(EqualIf()
+              .unifyAll(arrayIter(cached->unify))
+              .constrAll(arrayIter(cached->constr))));
+        break;
+    }
+  } else {
+    res = computeAbstraction(au, t1, t2);
+    if (cacheable) {
+      CachedAbstraction entry;
+      entry.kind = res.isNone() ? CachedAbstraction::NOT_APPLICABLE
+                 : res->is<NeverEqual>() ? CachedAbstraction::NEVER_EQUAL
+                 : CachedAbstraction::EQUAL_IF;
+      if (entry.kind == CachedAbstraction::EQUAL_IF) {
+        auto& e = res->unwrap<EqualIf>();
+        entry.unify.loadFromIterator(arrayIter(e.unify()));
+        entry.constr.loadFromIterator(arrayIter(e.constr()));
+      }
+      if (entry.kind != CachedAbstraction::EQUAL_IF || (isGround(entry.unify) && isGround(entry.constr))) {
+        if (cache.size() >= CACHE_LIMIT) {
+          cache.reset();
+        }
+        cache.insert(key, std::move(entry));
+      }
+    }
+  }
+
+  if (res.isSome()) {
+    if (res->is<NeverEqual>()) {
+      env.statistics->uwaAbstractionsNeverEqual++;
+    } else {
+      env.statistics->uwaAbstractionsEqualIf++;
+      env.statistics->uwaAbstractionConstraints += res->unwrap<EqualIf>().constr().size();
+    }
+  }
+  return res;
+}
+
+Option<AbstractionOracle::AbstractionResult> AbstractionOracle::computeAbstraction(AbstractingUnifier* au, TermSpec const& t1, TermSpec const& t2) const
+{
   if (_mode == Shell::Options::UnificationWithAbstraction::FUNC_EXT) {
     return funcExt(au, t1, t2);
 
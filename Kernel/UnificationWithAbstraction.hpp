@@ -140,6 +140,11 @@ public:
   static Shell::Options::UnificationWithAbstraction createOnlyHigherOrder();
 
 private:
+  Option<AbstractionResult> computeAbstraction(
+      AbstractingUnifier* au,
+      TermSpec const& t1,
+      TermSpec const& t2) const;
+
   // for old non-alasca uwa modes
   bool isInterpreted(unsigned f) const;
   bool canAbstract(
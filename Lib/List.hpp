@@ -760,6 +760,12 @@ public:
       return _first;
     }
 
+    /** The last cell of the list, 0 if empty. */
+    List* lastCell() const
+    {
+      return _last;
+    }
+
     /**
      * @brief If last's tail is not null, set it to null.
      *
@@ -38,6 +38,10 @@ public:
   BufferedSolver(SATSolver* inner);
 
   virtual SATClause* getRefutation() override { return _inner->getRefutation(); }
+
+  virtual uint64_t conflictCount() const override { return _inner->conflictCount(); }
+  virtual uint64_t propagationCount() const override { return _inner->propagationCount(); }
+  virtual unsigned learnedClauseCount() const override { return _inner->learnedClauseCount(); }
   virtual SATClauseList* getRefutationPremiseList() override {
     return _inner->getRefutationPremiseList();
   }
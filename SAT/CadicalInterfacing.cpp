@@ -91,6 +91,20 @@ void CadicalInterfacing::addClause(SATClause* cl)
   _solver.add(0);
 }
 
+void CadicalInterfacing::addClauses(const SATClauseArena& arena)
+{
+  ASS_EQ(_assumptions.size(),0);
+
+  for(unsigned i=0;i<arena.size();i++) {
+    const SATLiteral* lits = arena.literals(i);
+    unsigned clen = arena.length(i);
+    for(unsigned j=0;j<clen;j++) {
+      _solver.add(vampire2Cadical(lits[j]));
+    }
+    _solver.add(0);
+  }
+}
+
 /**
  * Perform solving and return status.
  */
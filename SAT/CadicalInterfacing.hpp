@@ -33,6 +33,11 @@ public:
    * A requirement is that in a clause, each variable occurs at most once.
    */
   virtual void addClause(SATClause* cl) override;
+
+  /**
+   * The literals go straight to the solver, nothing is recorded for refutations.
+   */
+  virtual void addClauses(const SATClauseArena& arena) override;
   
   /**
    * Opportunity to perform in-processing of the clause database.
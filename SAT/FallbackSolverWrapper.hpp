@@ -58,6 +58,12 @@ public:
 
   virtual void addClause(SATClause* cl) override;
   virtual Status solve(unsigned conflictCountLimit) override;
+
+  virtual uint64_t conflictCount() const override { return _inner->conflictCount() + _fallback->conflictCount(); }
+  virtual uint64_t propagationCount() const override { return _inner->propagationCount() + _fallback->propagationCount(); }
+  virtual unsigned learnedClauseCount() const override {
+    return _usingFallback ? _fallback->learnedClauseCount() : _inner->learnedClauseCount();
+  }
   virtual VarAssignment getAssignment(unsigned var) override;
 
   virtual bool isZeroImplied(unsigned var) override {
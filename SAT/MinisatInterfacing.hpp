@@ -44,6 +44,10 @@ public:
   }
 
   virtual Status solve(unsigned conflictCountLimit) override;
+
+  virtual uint64_t conflictCount() const override { return _solver.conflicts; }
+  virtual uint64_t propagationCount() const override { return _solver.propagations; }
+  virtual unsigned learnedClauseCount() const override { return _solver.nLearnts(); }
   
   /**
    * If status is @c SATISFIABLE, return assignment of variable @c var
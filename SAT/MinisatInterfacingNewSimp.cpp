@@ -155,6 +155,26 @@ void MinisatInterfacingNewSimp::addClause(SATClause* cl)
   }
 }
 
+void MinisatInterfacingNewSimp::addClauses(const SATClauseArena& arena)
+{
+  ASS_EQ(_assumptions.size(),0);
+
+  try {
+    static vec<Lit> mcl;
+    for(unsigned i=0;i<arena.size();i++) {
+      mcl.clear();
+      const SATLiteral* lits = arena.literals(i);
+      unsigned clen = arena.length(i);
+      for(unsigned j=0;j<clen;j++) {
+        mcl.push(vampireLit2Minisat(lits[j]));
+      }
+      _solver.addClause(mcl);
+    }
+  } catch (Minisat::OutOfMemoryException&){
+      reportMinisatOutOfMemory();
+  }
+}
+
 /**
  * Perform solving and return status.
  */
@@ -40,6 +40,11 @@ public:
    * A requirement is that in a clause, each variable occurs at most once.
    */
   virtual void addClause(SATClause* cl) override;
+
+  /**
+   * The literals go straight to the solver, nothing is recorded for refutations.
+   */
+  virtual void addClauses(const SATClauseArena& arena) override;
   
   /**
    * Opportunity to perform in-processing of the clause database.
@@ -51,6 +56,10 @@ public:
   }
 
   virtual Status solve(unsigned conflictCountLimit) override;
+
+  virtual uint64_t conflictCount() const override { return _solver.conflicts; }
+  virtual uint64_t propagationCount() const override { return _solver.propagations; }
+  virtual unsigned learnedClauseCount() const override { return _solver.nLearnts(); }
   
   /**
    * If status is @c SATISFIABLE, return assignment of variable @c var
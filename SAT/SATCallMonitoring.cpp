@@ -0,0 +1,74 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATCallMonitoring.cpp
+ * Implements classes SATCallRecorder and AdaptiveConflictBudget.
+ */
+
+#include <algorithm>
+
+#include "Shell/Statistics.hpp"
+
+#include "SATCallMonitoring.hpp"
+
+namespace SAT
+{
+
+SATCallRecorder::SATCallRecorder(const SATSolver& solver, Shell::SATCallStatistics& stats)
+  : _solver(solver), _stats(stats), _start(std::chrono::steady_clock::now()),
+    _conflicts(solver.conflictCount()), _propagations(solver.propagationCount())
+{
+}
+
+SATSolver::Status SATCallRecorder::record(SATSolver::Status res)
+{
+  record();
+  if (res == SATSolver::Status::UNSATISFIABLE) {
+    _stats.unsatisfiable++;
+  } else if (res == SATSolver::Status::UNKNOWN) {
+    _stats.unknown++;
+  }
+  return res;
+}
+
+void SATCallRecorder::record()
+{
+  _stats.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+  _conflicts = _solver.conflictCount() - _conflicts;
+  _stats.calls++;
+  _stats.conflicts += _conflicts;
+  _stats.propagations += _solver.propagationCount() - _propagations;
+  _stats.maxLearnedClauses = std::max(_stats.maxLearnedClauses, _solver.learnedClauseCount());
+}
+
+void AdaptiveConflictBudget::record(bool useful, uint64_t conflicts)
+{
+  _calls++;
+  if (useful) {
+    _useful++;
+  }
+  _maxConflicts = std::max(_maxConflicts, conflicts);
+
+  if (_calls < WINDOW) {
+    return;
+  }
+
+  if (_useful * GROW_RATIO >= _calls) {
+    _limit = (_limit < _max / 2) ? std::max(2 * _limit, 1u) : _max;
+  } else if (_useful * SHRINK_RATIO < _calls) {
+    _limit = (unsigned)std::min<uint64_t>(_limit, _maxConflicts) / 2;
+  }
+
+  _calls = 0;
+  _useful = 0;
+  _maxConflicts = 0;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATCallMonitoring.hpp
+ * Defines classes SATCallRecorder and AdaptiveConflictBudget.
+ */
+
+#ifndef __SATCallMonitoring__
+#define __SATCallMonitoring__
+
+#include <chrono>
+
+#include "Forwards.hpp"
+
+#include "SATSolver.hpp"
+
+namespace Shell { struct SATCallStatistics; }
+
+namespace SAT {
+
+/**
+ * Accounts one call of a SAT solver to the statistics of its call site.
+ *
+ * Create it just before the call and pass the result through record()
+ * just after; the solver's counters are compared with their values at creation.
+ */
+class SATCallRecorder
+{
+public:
+  SATCallRecorder(const SATSolver& solver, Shell::SATCallStatistics& stats);
+
+  /** Account the call which has just returned @c res and pass @c res on. */
+  SATSolver::Status record(SATSolver::Status res);
+
+  /** Account a call without a single status (e.g. a minimization of failed assumptions). */
+  void record();
+
+  /** Conflicts taken by the recorded call. */
+  uint64_t conflicts() const { return _conflicts; }
+
+private:
+  const SATSolver& _solver;
+  Shell::SATCallStatistics& _stats;
+  std::chrono::steady_clock::time_point _start;
+  uint64_t _conflicts;
+  uint64_t _propagations;
+};
+
+/**
+ * A conflict limit for repeated solver calls of one call site,
+ * adjusted by how often the calls pay off.
+ *
+ * The calls are judged in windows of WINDOW calls. When a window had
+ * enough useful calls the limit doubles (up to the maximum it was created with),
+ * when it had almost none, the limit is halved below the most conflicts any
+ * of its calls needed. A limit of 0 means unit propagation only.
+ */
+class AdaptiveConflictBudget
+{
+public:
+  AdaptiveConflictBudget(unsigned max) : _limit(max), _max(max), _calls(0), _useful(0), _maxConflicts(0) {}
+
+  unsigned limit() const { return _limit; }
+
+  /** Record a call made with limit() which took @c conflicts and paid off iff @c useful. */
+  void record(bool useful, uint64_t conflicts);
+
+private:
+  static const unsigned WINDOW = 64;
+  /** grow when at least one in GROW_RATIO calls of a window was useful */
+  static const unsigned GROW_RATIO = 8;
+  /** shrink when fewer than one in SHRINK_RATIO calls of a window were useful */
+  static const unsigned SHRINK_RATIO = 64;
+
+  unsigned _limit;
+  unsigned _max;
+
+  // the current window
+  unsigned _calls;
+  unsigned _useful;
+  uint64_t _maxConflicts;
+};
+
+}
+
+#endif // __SATCallMonitoring__
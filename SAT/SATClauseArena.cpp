@@ -0,0 +1,67 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATClauseArena.cpp
+ * Implements class SATClauseArena.
+ */
+
+#include <algorithm>
+
+#include "Shell/Shuffling.hpp"
+
+#include "SATClause.hpp"
+
+#include "SATClauseArena.hpp"
+
+namespace SAT
+{
+
+bool SATClauseArena::add(SATLiteralStack& lits)
+{
+  // the same (descending) order as SATClause::sort
+  std::sort(lits.begin(),lits.end(),[](SATLiteral l1, SATLiteral l2) { return l1.content()>l2.content(); });
+
+  unsigned offset = _literals.size();
+  _literals.push(SATLiteral(0u));
+  unsigned len = 0;
+  for(unsigned i=0;i<lits.size();i++) {
+    if(i>0 && lits[i-1].var()==lits[i].var()) {
+      if(lits[i-1].polarity()==lits[i].polarity()) {
+        continue;
+      }
+      // a tautology, take it back
+      _literals.truncate(offset);
+      return false;
+    }
+    _literals.push(lits[i]);
+    len++;
+  }
+  _literals[offset] = SATLiteral(len);
+  _offsets.push(offset);
+  return true;
+}
+
+SATClause* SATClauseArena::toClause(unsigned i) const
+{
+  unsigned len = length(i);
+  const SATLiteral* lits = literals(i);
+  SATClause* cl = new(len) SATClause(len);
+  for(unsigned j=0;j<len;j++) {
+    (*cl)[j] = lits[j];
+  }
+  return cl;
+}
+
+void SATClauseArena::shuffle()
+{
+  Shell::Shuffling::shuffleArray(_offsets,_offsets.size());
+}
+
+}
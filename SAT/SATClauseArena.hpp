@@ -0,0 +1,76 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SATClauseArena.hpp
+ * Defines class SATClauseArena.
+ */
+
+#ifndef __SATClauseArena__
+#define __SATClauseArena__
+
+#include "Forwards.hpp"
+
+#include "Lib/Stack.hpp"
+
+#include "SATLiteral.hpp"
+
+namespace SAT {
+
+using namespace Lib;
+
+/**
+ * A store of clauses keeping all their literals in one contiguous buffer.
+ *
+ * A clause is its length followed by its literals; the clauses are referred to
+ * by the 32-bit offsets of their lengths in the buffer. There is no per-clause
+ * allocation and no SATInference, so the store is meant for producers of many
+ * clauses which only need to pass them on to a solver (e.g. the finite model builder).
+ * Solvers take the whole store at once via SATSolver::addClauses.
+ */
+class SATClauseArena
+{
+public:
+  /**
+   * Add the clause consisting of @b lits, which get sorted and freed of duplicates.
+   * Return false if the clause is a tautology, in which case it is not added.
+   */
+  bool add(SATLiteralStack& lits);
+
+  /** Number of clauses in the store */
+  unsigned size() const { return _offsets.size(); }
+  bool isEmpty() const { return _offsets.isEmpty(); }
+
+  /** Length of the @b i-th clause */
+  unsigned length(unsigned i) const { return _literals[_offsets[i]].content(); }
+  /** The literals of the @b i-th clause */
+  const SATLiteral* literals(unsigned i) const { return _literals.begin()+_offsets[i]+1; }
+
+  /** A new SATClause with the literals of the @b i-th clause */
+  SATClause* toClause(unsigned i) const;
+
+  /** Put the clauses in a random order */
+  void shuffle();
+
+  void reset()
+  {
+    _literals.reset();
+    _offsets.reset();
+  }
+
+private:
+  /** The lengths and literals of all the clauses, the lengths stored as literal contents */
+  SATLiteralStack _literals;
+  /** The offsets of the clauses in _literals */
+  Stack<unsigned> _offsets;
+};
+
+};
+
+#endif /* __SATClauseArena__ */
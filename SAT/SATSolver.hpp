@@ -17,6 +17,7 @@
 
 #include "SATLiteral.hpp"
 #include "SATInference.hpp"
+#include "SATClauseArena.hpp"
 
 #include <climits>
 
@@ -57,6 +58,19 @@ public:
     }
   }
 
+  /**
+   * Add all the clauses of the arena.
+   *
+   * The arena's clauses carry no inferences and a solver overriding this
+   * does not have to record them for its refutations. This default implementation
+   * creates a SATClause for each of them, which the solver is then given as by addClause.
+   */
+  virtual void addClauses(const SATClauseArena& arena) {
+    for (unsigned i = 0; i < arena.size(); i++) {
+      addClause(arena.toClause(i));
+    }
+  }
+
   /**
    * When a solver supports partial models (via DONT_CARE values in the assignment),
    * a partial model P computed must satisfy all the clauses added to the solver
@@ -88,6 +102,20 @@ public:
 
   Status solve(bool onlyPropagate=false) { return solve(onlyPropagate ? 0u : UINT_MAX); }
 
+  /**
+   * Number of conflicts encountered by all the solve calls so far.
+   *
+   * This and the two counters below are only used for statistics
+   * and stay 0 for solvers that do not report them.
+   */
+  virtual uint64_t conflictCount() const { return 0; }
+
+  /** Number of propagations performed by all the solve calls so far. */
+  virtual uint64_t propagationCount() const { return 0; }
+
+  /** Number of learned clauses the solver currently keeps. */
+  virtual unsigned learnedClauseCount() const { return 0; }
+
   /**
    * If status is @c SATISFIABLE, return assignment of variable @c var
    */
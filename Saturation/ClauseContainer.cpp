@@ -92,6 +92,15 @@ void PassiveClauseContainer::updateLimits(long long estReachableCnt)
 
 /////////////////   ActiveClauseContainer   //////////////////////
 
+ActiveClauseContainer::~ActiveClauseContainer()
+{
+  while (_freezeQueue.isNonEmpty()) {
+    Clause* c = _freezeQueue.pop_front().first;
+    c->setFrozen(false);
+    c->decRefCnt();
+  }
+}
+
 void ActiveClauseContainer::add(Clause* c)
 {
   TIME_TRACE("add clause")
@@ -99,6 +108,13 @@ void ActiveClauseContainer::add(Clause* c)
   ASS(c->store()==Clause::ACTIVE);
   ALWAYS(_clauses.insert(c));
   addedEvent.fire(c);
+
+  if (c->isFrozen()) {
+    // indices which retained the clause skipped it above
+    c->setFrozen(false);
+    ALWAYS(_frozen.remove(c).isSome());
+    env.statistics->satSplitReinsertionsAvoided++;
+  }
 }
 
 /**
@@ -114,6 +130,47 @@ void ActiveClauseContainer::remove(Clause* c)
   removedEvent.fire(c);
 } // Active::ClauseContainer::remove
 
+/**
+ * Remove Clause @b c from the Active store because the splits it depends on
+ * were deactivated, but keep it in the indices that retain frozen clauses
+ * (see Index::retainFrozen). These hide the clause from their retrievals
+ * and keep it until it is added back or dropped by dropFrozenBefore().
+ *
+ * Other listeners see an ordinary removal.
+ */
+void ActiveClauseContainer::freeze(Clause* c, unsigned time)
+{
+  ASS(c->store()==Clause::ACTIVE);
+  ASS(!c->isFrozen());
+
+  c->setFrozen(true);
+  c->incRefCnt();
+  ALWAYS(_frozen.insert(c, time));
+  _freezeQueue.push_back(std::make_pair(c, time));
+
+  ALWAYS(_clauses.remove(c));
+  removedEvent.fire(c);
+}
+
+/**
+ * Remove the clauses frozen before @b time and not added back since
+ * from the indices that retained them.
+ */
+void ActiveClauseContainer::dropFrozenBefore(unsigned time)
+{
+  while (_freezeQueue.isNonEmpty() && _freezeQueue.front().second < time) {
+    auto [c, frozenAt] = _freezeQueue.pop_front();
+    unsigned current;
+    // the clause may have been added back and frozen again since
+    if (c->isFrozen() && _frozen.find(c, current) && current == frozenAt) {
+      frozenDroppedEvent.fire(c);
+      c->setFrozen(false);
+      _frozen.remove(c);
+    }
+    c->decRefCnt();
+  }
+}
+
 void ActiveClauseContainer::onLimitsUpdated(PassiveClauseContainer* limits)
 {
   ASS(limits);
@@ -21,6 +21,7 @@
 #include "Lib/Event.hpp"
 #include "Lib/VirtualIterator.hpp"
 #include "Lib/Deque.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Stack.hpp"
 #include "Kernel/Clause.hpp"
 #include "Lib/Set.hpp"
@@ -56,6 +57,12 @@ public:
    * algorithm (e.g. activated).
    */
   ClauseEvent selectedEvent;
+  /**
+   * This event fires when a frozen clause stops being frozen
+   * without having been added back (see ActiveClauseContainer::freeze).
+   * Indices which retain frozen clauses must remove it then.
+   */
+  ClauseEvent frozenDroppedEvent;
   virtual void add(Clause* c) = 0;
   void addClauses(ClauseIterator cit) {
     while (cit.hasNext()) {
@@ -205,10 +212,14 @@ class ActiveClauseContainer
 {
 public:
   ActiveClauseContainer() {}
+  ~ActiveClauseContainer() override;
 
   void add(Clause* c) override;
   void remove(Clause* c) override;
 
+  void freeze(Clause* c, unsigned time);
+  void dropFrozenBefore(unsigned time);
+
   unsigned sizeEstimate() const override { return _clauses.size(); }
   ClauseIterator clauses() const { return pvi(_clauses.iter()); }
 
@@ -217,6 +228,10 @@ protected:
   void onLimitsUpdated(PassiveClauseContainer* limits);
 private:
   Set<Clause*> _clauses;
+  /** Frozen clauses with the time they were frozen at */
+  DHMap<Clause*, unsigned> _frozen;
+  /** Clauses in the order they were frozen, each holding a reference */
+  Deque<std::pair<Clause*, unsigned>> _freezeQueue;
   // const Shell::Options& _opt;
 };
 
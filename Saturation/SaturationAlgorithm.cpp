@@ -1013,11 +1013,12 @@ void SaturationAlgorithm::backwardSimplify(Clause* cl)
       ASS_NEQ(redundant, cl);
 
       Clause *replacement = srec.replacement;
+      Clause *premise = srec.premise ? srec.premise : cl;
 
       if (replacement) {
         addNewClause(replacement);
       }
-      onClauseReduction(redundant, &replacement, 1, cl, false);
+      onClauseReduction(redundant, &replacement, 1, premise, false);
 
       // we must remove the redundant clause before adding its replacement,
       // as otherwise the redundant one might demodulate the replacement into
@@ -1143,11 +1144,8 @@ void SaturationAlgorithm::activate(Clause* cl)
 
   _partialRedundancyHandler->checkEquations(cl);
 
-  auto generated = TIME_TRACE_EXPR(TimeTrace::CLAUSE_GENERATION, _generator->generateSimplify(cl));
-  auto toAdd = TIME_TRACE_ITER(TimeTrace::CLAUSE_GENERATION, generated.clauses);
-
-  while (toAdd.hasNext()) {
-    Clause *genCl = toAdd.next();
+  // generated clauses are pushed to us directly, without an iterator pipeline
+  auto sink = clauseSink([this](Clause* genCl) {
     addNewClause(genCl);
 
     Inference::Iterator iit = genCl->inference().iterator();
@@ -1161,7 +1159,8 @@ void SaturationAlgorithm::activate(Clause* cl)
         onParenthood(genCl, premCl);
       }
     }
-  }
+  });
+  bool premiseRedundant = TIME_TRACE_EXPR(TimeTrace::CLAUSE_GENERATION, _generator->pushGenerateSimplify(cl, sink));
 
   _clauseActivationInProgress = false;
 
@@ -1180,7 +1179,7 @@ void SaturationAlgorithm::activate(Clause* cl)
     removeActiveOrPassiveClause(cl);
   }
 
-  if (generated.premiseRedundant) {
+  if (premiseRedundant) {
     _active->remove(cl);
   }
 
@@ -39,6 +39,7 @@
 #include "Shell/Statistics.hpp"
 #include "Shell/Shuffling.hpp"
 
+#include "SAT/SATCallMonitoring.hpp"
 #include "SAT/SATInference.hpp"
 #include "SAT/MinimizingSolver.hpp"
 #include "SAT/BufferedSolver.hpp"
@@ -73,6 +74,8 @@ void SplitDefinitionExtra::output(std::ostream &out) const {
 void SplittingBranchSelector::init()
 {
   _eagerRemoval = _parent.getOptions().splittingEagerRemoval();
+  _reuseModel = _parent.getOptions().splittingModelReuse();
+  _repairModel = _parent.getOptions().splittingModelRepair();
   _literalPolarityAdvice = _parent.getOptions().splittingLiteralPolarityAdvice();
 
   switch(_parent.getOptions().satSolver()){
@@ -437,8 +440,9 @@ SATSolver::Status SplittingBranchSelector::processDPConflicts()
     // there was conflict, so we try looking for a different model
     {
       TIME_TRACE(TimeTrace::AVATAR_SAT_SOLVER);
-      
-      if (_solver->solve() == SATSolver::Status::UNSATISFIABLE) {
+
+      SATCallRecorder rec(*_solver, env.statistics->splitterSatCalls);
+      if (rec.record(_solver->solve()) == SATSolver::Status::UNSATISFIABLE) {
         return SATSolver::Status::UNSATISFIABLE;
       }
     }
@@ -562,6 +566,26 @@ void SplittingBranchSelector::updateSelection(unsigned satVar, SATSolver::VarAss
   }
 }
 
+/**
+ * Return true if some literal of @b cl is true in the assignment
+ * obtained from the last solver call
+ */
+bool SplittingBranchSelector::satisfiedByModel(SATClause* cl) const
+{
+  for(unsigned i = 0; i < cl->length(); i++) {
+    SATLiteral lit = (*cl)[i];
+    if(lit.var() >= _model.size()) {
+      continue;
+    }
+    SATSolver::VarAssignment asgn = _model[lit.var()];
+    if((asgn == SATSolver::VarAssignment::TRUE && lit.isPositive()) ||
+       (asgn == SATSolver::VarAssignment::FALSE && lit.isNegative())) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void SplittingBranchSelector::addSatClauseToSolver(SATClause* cl, bool branchRefutation)
 {
   cl = SATClause::removeDuplicateLiterals(cl);
@@ -572,6 +596,10 @@ void SplittingBranchSelector::addSatClauseToSolver(SATClause* cl, bool branchRef
 
   RSTAT_CTR_INC("ssat_sat_clauses");
 
+  if(!_reuseModel || !satisfiedByModel(cl)) {
+    _modelViolated = true;
+  }
+
   if (branchRefutation && _minSCO) {
     _solver->addClauseIgnoredInPartialModel(cl);
   } else {
@@ -585,14 +613,42 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
   ASS(removedComps.isEmpty());
 
   unsigned maxSatVar = _parent.maxSatVar();
-  
+
+  if(_reuseModel && !randomize && !_modelViolated && maxSatVar < _model.size()) {
+    // the last model still satisfies everything the solver has seen,
+    // we only need to pick up components named since then
+    env.statistics->satSplitModelsReused++;
+    for(unsigned i=1; i<=maxSatVar; i++) {
+      updateSelection(i, _model[i], addedComps, removedComps);
+    }
+    return;
+  }
+  _modelViolated = false;
+  if(_repairModel && !randomize) {
+    // steer the solver towards the previous model, so that only the
+    // variables that really have to change get flipped
+    for(unsigned i=1; i<_model.size(); i++) {
+      if(_model[i] == SATSolver::VarAssignment::TRUE) {
+        _solver->suggestPolarity(i, 1);
+      }
+      else if(_model[i] == SATSolver::VarAssignment::FALSE) {
+        _solver->suggestPolarity(i, 0);
+      }
+    }
+  }
+  if(_reuseModel || _repairModel) {
+    _model.reset();
+    _model.push(SATSolver::VarAssignment::DONT_CARE); // there is no variable 0
+  }
+
   SATSolver::Status stat;
   {
     TIME_TRACE(TimeTrace::AVATAR_SAT_SOLVER);
     if (randomize) {
       _solver->randomizeForNextAssignment(maxSatVar);
     }
-    stat = _solver->solve();
+    SATCallRecorder rec(*_solver, env.statistics->splitterSatCalls);
+    stat = rec.record(_solver->solve());
   }
   if (stat == SATSolver::Status::SATISFIABLE) {
     stat = processDPConflicts();
@@ -618,6 +674,9 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
       env.statistics->smtDidNotEvaluate=true;
       throw MainLoop::MainLoopFinishedException(Statistics::REFUTATION_NOT_FOUND);
     }
+    if(_reuseModel || _repairModel) {
+      _model.push(asgn);
+    }
 
     updateSelection(i, asgn, addedComps, removedComps);
   }
@@ -708,6 +767,8 @@ void Splitter::init(SaturationAlgorithm* sa)
 
   _fastRestart = opts.splittingFastRestart();
   _deleteDeactivated = opts.splittingDeleteDeactivated();
+  _lazyReinsertion = opts.splittingLazyReinsertion();
+  _deactivations = 0;
 
   if (opts.useHashingVariantIndex()) {
     _componentIdx = new HashingClauseVariantIndex();
@@ -1697,6 +1758,7 @@ void Splitter::addComponents(const SplitLevelStack& toAdd)
     ASS(sr);
     ASS(!sr->active);
     sr->active = true;
+    env.statistics->satSplitComponentsActivated++;
     
     if (_deleteDeactivated == Options::SplittingDeleteDeactivated::ON) {
       ASS(sr->children.isEmpty());
@@ -1704,6 +1766,7 @@ void Splitter::addComponents(const SplitLevelStack& toAdd)
       //so that it is backtracked when we remove the component
       sr->children.push(sr->component);
       _sa->addNewClause(sr->component);
+      env.statistics->satSplitClausesRestored++;
     } else {
       // children were kept, so we just put them back
       RCClauseStack::Iterator chit(sr->children);
@@ -1712,6 +1775,7 @@ void Splitter::addComponents(const SplitLevelStack& toAdd)
         cl->incNumActiveSplits();
         if (cl->getNumActiveSplits() == (int)cl->splits()->size()) {
           _sa->addNewClause(cl);
+          env.statistics->satSplitClausesRestored++;
           //check that restored clause does not depend on inactive splits
           ASS(allSplitLevelsActive(cl->splits()));
         }
@@ -1732,6 +1796,13 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
   
   SplitSet* backtracked = SplitSet::getFromArray(toRemove.begin(), toRemove.size());
 
+  ActiveClauseContainer* active = _sa->getActiveClauseContainer();
+  _deactivations++;
+  if (_lazyReinsertion && _deactivations >= _lazyReinsertion) {
+    // children frozen this long ago were not needed again
+    active->dropFrozenBefore(_deactivations - _lazyReinsertion + 1);
+  }
+
   // ensure all children are backtracked
   // i.e. removed from _sa and reference counter dec
   auto blit = backtracked->iter();
@@ -1739,14 +1810,25 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
     SplitLevel bl=blit.next();
     SplitRecord* sr=_db[bl];
     ASS(sr);
+    env.statistics->satSplitComponentsDeactivated++;
     
     RCClauseStack::DelIterator chit(sr->children);
     while (chit.hasNext()) {
       Clause* ccl=chit.next();
       ASS(ccl->splits()->member(bl));
       if(ccl->store()!=Clause::NONE) {
-        _sa->removeActiveOrPassiveClause(ccl);
+        if(ccl->store()==Clause::ACTIVE && _lazyReinsertion) {
+          // keep it in the generating indices in case the component comes back soon
+          active->freeze(ccl, _deactivations);
+          env.statistics->satSplitActiveClausesFrozen++;
+        } else {
+          if(ccl->store()==Clause::ACTIVE) {
+            env.statistics->satSplitActiveClausesUnindexed++;
+          }
+          _sa->removeActiveOrPassiveClause(ccl);
+        }
         ASS_EQ(ccl->store(), Clause::NONE);
+        env.statistics->satSplitClausesRemoved++;
       } else {
       }
       ccl->invalidateMyReductionRecords();
@@ -1786,6 +1868,7 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
         
         rcl->invalidateMyReductionRecords(); // to make sure we don't unfreeze this clause a second time
         _sa->addNewClause(rcl);
+        env.statistics->satSplitClausesRestored++;
               
         // TODO: keep statistics in release ?
         // RSTAT_MCTR_INC("unfrozen clauses",rcl->getFreezeCount());
@@ -71,7 +71,7 @@ class Splitter;
  */
 class SplittingBranchSelector {
 public:
-  SplittingBranchSelector(Splitter& parent) : _ccModel(false), _parent(parent), _solverIsSMT(false)  {}
+  SplittingBranchSelector(Splitter& parent) : _ccModel(false), _modelViolated(true), _parent(parent), _solverIsSMT(false)  {}
   ~SplittingBranchSelector(){
 #if VZ3
 _solver=0;
@@ -101,12 +101,27 @@ private:
 
   int assertedGroundPositiveEqualityCompomentMaxAge();
 
+  bool satisfiedByModel(SATClause* cl) const;
+
   //options
   bool _eagerRemoval;
   Options::SplittingLiteralPolarityAdvice _literalPolarityAdvice;
   bool _ccMultipleCores;
   bool _minSCO; // minimize wrt splitting clauses only
   bool _ccModel;
+  bool _reuseModel;
+  bool _repairModel;
+
+  /**
+   * True if a SAT clause added since the last solver call is not known
+   * to be satisfied by @b _model
+   */
+  bool _modelViolated;
+  /**
+   * The assignment from the last solver call, indexed by SAT variables
+   * (only maintained with _reuseModel or _repairModel)
+   */
+  Stack<SATSolver::VarAssignment> _model;
 
   Splitter& _parent;
 
@@ -269,6 +284,8 @@ private:
   unsigned _flushPeriod;
   float _flushQuotient;
   Options::SplittingDeleteDeactivated _deleteDeactivated;
+  /** for how many deactivations active children stay frozen, 0 if they are removed right away */
+  unsigned _lazyReinsertion;
   Options::SplittingCongruenceClosure _congruenceClosure;
   bool _shuffleComponents;
 #if VZ3
@@ -324,6 +341,8 @@ private:
   RCClauseStack _fastClauses;
   
   SaturationAlgorithm* _sa;
+  /** number of calls to removeComponents, the time for freezing children */
+  unsigned _deactivations;
 
   // clauses we already added to the SAT solver
   // not just optimisation: also prevents the SAT solver oscillating between two models in some cases
@@ -65,6 +65,10 @@ void NewCNF::clausify(FormulaUnit* unit,Stack<Clause*>& output)
       break;
   }
 
+  if (clausifyDirectly(f, output)) {
+    return;
+  }
+
   ASS(_genClauses.empty());
   ASS(_queue.isEmpty());
   ASS(_occurrences.isEmpty());
@@ -125,6 +129,69 @@ void NewCNF::clausify(FormulaUnit* unit,Stack<Clause*>& output)
   ASS(_occurrences.isEmpty());
 }
 
+/**
+ * If @b f is a universally closed disjunction of shared literals (or a single
+ * such literal), which is the case for most axioms of large ontologies, push
+ * the corresponding clause to @b output and return true. Otherwise return false
+ * and leave @b output untouched.
+ *
+ * The result is exactly the one of the general algorithm, which expands the
+ * disjunction in the reverse order of its arguments and eliminates duplicate
+ * literals and tautologies in pushLiteral(), but we do not build any generalised
+ * clauses or occurrence lists for it.
+ */
+bool NewCNF::clausifyDirectly(Formula* f, Stack<Clause*>& output)
+{
+  while (f->connective() == FORALL) {
+    f = f->qarg();
+  }
+
+  RStack<Literal*> lits;
+  if (f->connective() == LITERAL) {
+    if (!f->literal()->shared()) {
+      return false;
+    }
+    lits->push(f->literal());
+  } else if (f->connective() == OR) {
+    FormulaList::Iterator fit(f->args());
+    while (fit.hasNext()) {
+      Formula* arg = fit.next();
+      if (arg->connective() != LITERAL || !arg->literal()->shared()) {
+        return false;
+      }
+      lits->push(arg->literal());
+    }
+  } else {
+    return false;
+  }
+
+  ASS(_literalsCache.isEmpty());
+
+  RStack<Literal*> resLits;
+  bool tautology = false;
+  Stack<Literal*>::TopFirstIterator lit(*lits);
+  while (lit.hasNext()) {
+    Literal* l = lit.next();
+    Literal* pl = l->isPositive() ? l : Literal::complementaryLiteral(l);
+    SIGN s = l->isPositive() ? POSITIVE : NEGATIVE;
+    if (!_literalsCache.insert(pl, s)) {
+      if (_literalsCache.get(pl) != s) {
+        tautology = true;
+        break;
+      }
+      LOG2("Found duplicate literal", l->toString());
+      continue;
+    }
+    resLits->push(l);
+  }
+  _literalsCache.reset();
+
+  if (!tautology) {
+    output.push(Clause::fromStack(*resLits,FormulaClauseTransformation(InferenceRule::CLAUSIFY,_beingClausified)));
+  }
+  return true;
+}
+
 void NewCNF::process(Literal* literal, Occurrences &occurrences) {
   LOG2("process(Literal*)", literal->toString());
   LOG2("occurrences.size", occurrences.size());
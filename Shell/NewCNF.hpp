@@ -72,6 +72,8 @@ private:
 
   FormulaUnit* _beingClausified;
 
+  bool clausifyDirectly(Formula* f, Stack<Clause*>& output);
+
   /**
    * Queue of formulas to process.
    *
@@ -121,6 +121,14 @@ void Options::init()
     _interactive.setExperimental();
     _lookup.insert(&_interactive);
 
+    _server = BoolOptionValue("server","",false);
+    _server.description = "An experimental server mode for many conjectures over one large axiom base. "
+      "The input file (the axiom base) is parsed, scanned for its properties and indexed for SInE only once. "
+      "Each line then read from the standard input ([options] <conjecture file>) is solved in a child forked from this warm state. "
+      "The line 'exit' stops the server.";
+    _server.setExperimental();
+    _lookup.insert(&_server);
+
     _mode = ChoiceOptionValue<Mode>("mode","",Mode::VAMPIRE,
                                     {"axiom_selection",
                                         "casc",
@@ -597,6 +605,12 @@ void Options::init()
     // Captures that if the value is not 1.0 then sineSelection must be on
     _sineTolerance.onlyUsefulWith(_sineSelection.is(notEqual(SineSelection::OFF)));
 
+    _sineSharedIndex = BoolOptionValue("sine_shared_index","",true);
+    _sineSharedIndex.description="In the portfolio and server modes, compute symbol generality and the D-relation for SInE once in the parent process"
+    " and let all the strategies selecting by SInE share them, whatever their tolerance, depth or generality threshold.";
+    _lookup.insert(&_sineSharedIndex);
+    _sineSharedIndex.tag(OptionTag::PREPROCESSING);
+
     _naming = IntOptionValue("naming","nm",8);
     _naming.description="Introduce names for subformulas. Given a subformula F(x1,..,xk) of formula G a new predicate symbol is introduced as a name for F(x1,..,xk) by adding the axiom n(x1,..,xk) <=> F(x1,..,xk) and replacing F(x1,..,xk) with n(x1,..,xk) in G. The value indicates how many times a subformula must be used before it is named.";
     _lookup.insert(&_naming);
@@ -869,6 +883,22 @@ void Options::init()
     _fmbSymmetryWidgetOrders.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
     _fmbSymmetryWidgetOrders.tag(OptionTag::FMB);
 
+    _fmbSymmetryDetection = BoolOptionValue("fmb_symmetry_detection","fmbsd",false);
+    _fmbSymmetryDetection.description = "Detect constants which can be swapped without changing the flattened problem"
+                                        " (by partition refinement) and order their values.";
+    _lookup.insert(&_fmbSymmetryDetection);
+    _fmbSymmetryDetection.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
+    _fmbSymmetryDetection.setExperimental();
+    _fmbSymmetryDetection.tag(OptionTag::FMB);
+
+    _fmbPruneInstances = BoolOptionValue("fmb_prune_instances","fmbpi",false);
+    _fmbPruneInstances.description = "Do not generate the ground instances satisfied by the unit facts already known to the SAT solver"
+                                     " (e.g. the first constant being 1) and leave out the literals falsified by them.";
+    _lookup.insert(&_fmbPruneInstances);
+    _fmbPruneInstances.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
+    _fmbPruneInstances.setExperimental();
+    _fmbPruneInstances.tag(OptionTag::FMB);
+
     _fmbAdjustSorts = ChoiceOptionValue<FMBAdjustSorts>("fmb_adjust_sorts","fmbas",
                                                            FMBAdjustSorts::GROUP,
                                                            {"off","expand","group","predicate","function"});
@@ -918,6 +948,30 @@ void Options::init()
     _fmbKeepSbeamGenerators.onlyUsefulWith(_fmbEnumerationStrategy.is(equal(FMBEnumerationStrategy::SBMEAM)));
     _fmbKeepSbeamGenerators.tag(OptionTag::FMB);
 
+    _fmbIncremental = BoolOptionValue("fmb_incremental","fmbi",false);
+    _fmbIncremental.description = "Keep the SAT solver (and its learned clauses) when the contour strategy grows a sort"
+                                  " and only add the constraints that are new for the larger sizes."
+                                  " Requires cadical as the SAT solver.";
+    _lookup.insert(&_fmbIncremental);
+    _fmbIncremental.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
+    _fmbIncremental.onlyUsefulWith(_fmbEnumerationStrategy.is(equal(FMBEnumerationStrategy::CONTOUR)));
+    _fmbIncremental.onlyUsefulWith(_satSolver.is(equal(SatSolver::CADICAL)));
+    _fmbIncremental.setExperimental();
+    _fmbIncremental.tag(OptionTag::FMB);
+
+    _fmbWorkers = UnsignedOptionValue("fmb_workers","fmbw",1);
+    _fmbWorkers.description = "Number of processes exploring different sort size assignments at the same time."
+                              " The processes share the nogoods they learn and stop when one of them finds a model."
+                              " Only the first 4096 nogoods are shared; when there are more, the workers running out of"
+                              " size assignments to try can no longer establish that there is no model.";
+    _fmbWorkers.addConstraint(greaterThan(0u));
+    _fmbWorkers.addConstraint(lessThanEq(64u));
+    _lookup.insert(&_fmbWorkers);
+    _fmbWorkers.onlyUsefulWith(_saturationAlgorithm.is(equal(SaturationAlgorithm::FINITE_MODEL_BUILDING)));
+    _fmbWorkers.onlyUsefulWith(_fmbEnumerationStrategy.is(notEqual(FMBEnumerationStrategy::CONTOUR)));
+    _fmbWorkers.setExperimental();
+    _fmbWorkers.tag(OptionTag::FMB);
+
     _selection = SelectionOptionValue("selection","s",10);
     _selection.description=
     "Selection methods 2,3,4,10,11 are complete by virtue of extending Maximal i.e. they select the best among maximal. Methods 1002,1003,1004,1010,1011 relax this restriction and are therefore not complete.\n"
@@ -950,6 +1004,15 @@ void Options::init()
     _lookup.insert(&_lookaheadDelay);
     _lookaheadDelay.onlyUsefulWith(_selection.isLookAheadSelection());
 
+    _lookaheadCountReuse = UnsignedOptionValue("lookahead_count_reuse","lcr",0);
+    _lookaheadCountReuse.description = "Let lookahead selection reuse the number of inferences it counted for a literal"
+                                       " during this many subsequent selections instead of querying the indices again"
+                                       " (0 means always query)";
+    _lookaheadCountReuse.tag(OptionTag::SATURATION);
+    _lookup.insert(&_lookaheadCountReuse);
+    _lookaheadCountReuse.onlyUsefulWith(_selection.isLookAheadSelection());
+    _lookaheadCountReuse.setExperimental();
+
     _ageWeightRatio = RatioOptionValue("age_weight_ratio","awr",1,1,':');
     _ageWeightRatio.description=
     "Ratio in which clauses are being selected for activation i.e. A:W means that for every A clauses selected based on age "
@@ -1595,6 +1658,16 @@ void Options::init()
     _backwardDemodulation.addProblemConstraint(hasEquality());
     _backwardDemodulation.onlyUsefulWith(ProperSaturationAlgorithm());
 
+    _backwardDemodulationBatch = UnsignedOptionValue("backward_demodulation_batch","bdb",1);
+    _backwardDemodulationBatch.description=
+       "Collect unit equalities for backward demodulation over this many activations "
+       "and then rewrite the kept clauses with all of them in a single sweep. 1 means no batching.";
+    _backwardDemodulationBatch.addConstraint(greaterThan(0u));
+    _backwardDemodulationBatch.onlyUsefulWith(_backwardDemodulation.is(notEqual(Demodulation::OFF)));
+    _backwardDemodulationBatch.setExperimental();
+    _lookup.insert(&_backwardDemodulationBatch);
+    _backwardDemodulationBatch.tag(OptionTag::INFERENCES);
+
     _backwardSubsumption = ChoiceOptionValue<Subsumption>("backward_subsumption","bs",
                 Subsumption::OFF,{"off","on","unit_only"});
     _backwardSubsumption.description=
@@ -2077,6 +2150,16 @@ void Options::init()
     _globalSubsumptionSatSolverPower.tag(OptionTag::INFERENCES);
     _globalSubsumptionSatSolverPower.onlyUsefulWith(_globalSubsumption.is(equal(true)));
 
+    _globalSubsumptionAdaptiveBudget = BoolOptionValue("global_subsumption_adaptive_budget","gsab",false);
+    _globalSubsumptionAdaptiveBudget.description=
+      "Adjust the conflict limits of the SAT solver calls of global subsumption (and of its explicit minimization) "
+      "to how often they pay off: the limits grow while the calls keep reducing clauses and shrink, down to unit propagation, "
+      "while they do not.";
+    _lookup.insert(&_globalSubsumptionAdaptiveBudget);
+    _globalSubsumptionAdaptiveBudget.tag(OptionTag::INFERENCES);
+    _globalSubsumptionAdaptiveBudget.onlyUsefulWith(_globalSubsumptionSatSolverPower.is(equal(GlobalSubsumptionSatSolverPower::FULL)));
+    _globalSubsumptionAdaptiveBudget.setExperimental();
+
     _globalSubsumptionExplicitMinim = ChoiceOptionValue<GlobalSubsumptionExplicitMinim>("global_subsumption_explicit_minim","gsem",
         GlobalSubsumptionExplicitMinim::RANDOMIZED,{"off","on","randomized"});
     _globalSubsumptionSatSolverPower.description="Explicitly minimize the result of global subsumption reduction.";
@@ -2095,6 +2178,16 @@ void Options::init()
     _globalSubsumptionAvatarAssumptions.onlyUsefulWith(_globalSubsumption.is(equal(true)));
     _globalSubsumptionAvatarAssumptions.onlyUsefulWith(_splitting.is(equal(true)));
 
+    _globalSubsumptionSharedNaming = BoolOptionValue("global_subsumption_shared_naming","gssn",false);
+    _globalSubsumptionSharedNaming.description=
+      "With AVATAR assumptions in global subsumption, name the split level of a ground component by the SAT literal which GS already "
+      "uses for the component's literal. The current AVATAR assignment is then assumed over the same atoms as the grounded clauses, "
+      "so GS can combine the two and needs no extra variables for such components.";
+    _lookup.insert(&_globalSubsumptionSharedNaming);
+    _globalSubsumptionSharedNaming.tag(OptionTag::INFERENCES);
+    _globalSubsumptionSharedNaming.onlyUsefulWith(_globalSubsumptionAvatarAssumptions.is(notEqual(GlobalSubsumptionAvatarAssumptions::OFF)));
+    _globalSubsumptionSharedNaming.setExperimental();
+
     _useHashingVariantIndex = BoolOptionValue("use_hashing_clause_variant_index","uhcvi",false);
     _useHashingVariantIndex.description= "Use clause variant index based on hashing for clause variant detection (affects avatar).";
     _lookup.insert(&_useHashingVariantIndex);
@@ -2183,6 +2276,23 @@ void Options::init()
     _splittingBufferedSolver.tag(OptionTag::AVATAR);
     _splittingBufferedSolver.onlyUsefulWith(_splitting.is(equal(true)));
 
+    _splittingModelReuse = BoolOptionValue("avatar_model_reuse","amr",false);
+    _splittingModelReuse.description="Keep the current AVATAR model without calling the SAT solver"
+                                     " as long as it satisfies all the SAT clauses added since the last call.";
+    _lookup.insert(&_splittingModelReuse);
+    _splittingModelReuse.tag(OptionTag::AVATAR);
+    _splittingModelReuse.onlyUsefulWith(_splitting.is(equal(true)));
+    _splittingModelReuse.setExperimental();
+
+    _splittingModelRepair = BoolOptionValue("avatar_model_repair","amrp",false);
+    _splittingModelRepair.description="Before each call to the AVATAR SAT solver, suggest the polarities of the previous model"
+                                      " so that the new model differs from it as little as possible"
+                                      " and fewer clauses need to be removed and restored.";
+    _lookup.insert(&_splittingModelRepair);
+    _splittingModelRepair.tag(OptionTag::AVATAR);
+    _splittingModelRepair.onlyUsefulWith(_splitting.is(equal(true)));
+    _splittingModelRepair.setExperimental();
+
     _splittingDeleteDeactivated = ChoiceOptionValue<SplittingDeleteDeactivated>("avatar_delete_deactivated","add",
                                                                         SplittingDeleteDeactivated::ON,{"on","large","off"});
 
@@ -2191,6 +2301,16 @@ void Options::init()
     _splittingDeleteDeactivated.tag(OptionTag::AVATAR);
     _splittingDeleteDeactivated.onlyUsefulWith(_splitting.is(equal(true)));
 
+    _splittingLazyReinsertion = UnsignedOptionValue("avatar_lazy_reinsertion","alr",0);
+    _splittingLazyReinsertion.description=
+    "Keep active clauses of deactivated components in the generating indices (hidden from their retrievals)"
+    " for the given number of further deactivations, so that they need not be inserted again if the component"
+    " comes back in the meantime. The code trees and the simplifying indices still drop them. If equal to zero, this is never done.";
+    _lookup.insert(&_splittingLazyReinsertion);
+    _splittingLazyReinsertion.tag(OptionTag::AVATAR);
+    _splittingLazyReinsertion.onlyUsefulWith(And(_splitting.is(equal(true)), _splittingDeleteDeactivated.is(notEqual(SplittingDeleteDeactivated::ON))));
+    _splittingLazyReinsertion.setExperimental();
+
     _splittingFlushPeriod = UnsignedOptionValue("avatar_flush_period","afp",0);
     _splittingFlushPeriod.description=
     "after given number of generated clauses without deriving an empty clause, the splitting component selection is shuffled. If equal to zero, shuffling is never performed.";
@@ -2420,6 +2540,14 @@ void Options::init()
     _kboAdmissabilityCheck.tag(OptionTag::SATURATION);
     _lookup.insert(&_kboAdmissabilityCheck);
 
+    _groundOrderingCache = UnsignedOptionValue("ground_ordering_cache","goc",0);
+    _groundOrderingCache.description = "Cache the results of comparing ground terms by the term ordering "
+      "(kbo or lpo) in a table with 2^N entries, where N is the value of this option. 0 means no caching.";
+    _groundOrderingCache.addConstraint(lessThanEq(24u));
+    _groundOrderingCache.setExperimental();
+    _groundOrderingCache.tag(OptionTag::SATURATION);
+    _lookup.insert(&_groundOrderingCache);
+
 
     _functionWeights = StringOptionValue("function_weights","fw","");
     _functionWeights.description =
@@ -1985,6 +1985,8 @@ public:
   unsigned fmbStartSize() const { return _fmbStartSize.actualValue;}
   float fmbSymmetryRatio() const { return _fmbSymmetryRatio.actualValue; }
   FMBWidgetOrders fmbSymmetryWidgetOrders() { return _fmbSymmetryWidgetOrders.actualValue;}
+  bool fmbSymmetryDetection() const { return _fmbSymmetryDetection.actualValue; }
+  bool fmbPruneInstances() const { return _fmbPruneInstances.actualValue; }
   FMBSymbolOrders fmbSymmetryOrderSymbols() const {return _fmbSymmetryOrderSymbols.actualValue; }
   FMBAdjustSorts fmbAdjustSorts() const {return _fmbAdjustSorts.actualValue; }
   bool fmbDetectSortBounds() const { return _fmbDetectSortBounds.actualValue; }
@@ -1992,6 +1994,8 @@ public:
   unsigned fmbSizeWeightRatio() const { return _fmbSizeWeightRatio.actualValue; }
   FMBEnumerationStrategy fmbEnumerationStrategy() const { return _fmbEnumerationStrategy.actualValue; }
   bool keepSbeamGenerators() const { return _fmbKeepSbeamGenerators.actualValue; }
+  bool fmbIncremental() const { return _fmbIncremental.actualValue; }
+  unsigned fmbWorkers() const { return _fmbWorkers.actualValue; }
 
   bool flattenTopLevelConjunctions() const { return _flattenTopLevelConjunctions.actualValue; }
   Mode mode() const { return _mode.actualValue; }
@@ -2112,6 +2116,7 @@ public:
   bool arityCheck() const { return _arityCheck.actualValue; }
   //void setArityCheck(bool newVal) { _arityCheck=newVal; }
   Demodulation backwardDemodulation() const { return _backwardDemodulation.actualValue; }
+  unsigned backwardDemodulationBatch() const { return _backwardDemodulationBatch.actualValue; }
   DemodulationRedundancyCheck demodulationRedundancyCheck() const { return _demodulationRedundancyCheck.actualValue; }
   bool forwardDemodulationTermOrderingDiagrams() const { return _forwardDemodulationTermOrderingDiagrams.actualValue; }
   bool demodulationOnlyEquational() const { return _demodulationOnlyEquational.actualValue; }
@@ -2128,6 +2133,7 @@ public:
   int lrsWeightLimitOnly() const { return _lrsWeightLimitOnly.actualValue; }
   int lrsRetroactiveDeletes() const { return _lrsRetroactiveDeletes.actualValue; }
   int lookaheadDelay() const { return _lookaheadDelay.actualValue; }
+  unsigned lookaheadCountReuse() const { return _lookaheadCountReuse.actualValue; }
   int simulatedTimeLimit() const { return _simulatedTimeLimit.actualValue; }
   void setSimulatedTimeLimit(int newVal) { _simulatedTimeLimit.actualValue = newVal; }
   float lrsEstimateCorrectionCoef() const { return _lrsEstimateCorrectionCoef.actualValue; }
@@ -2138,6 +2144,7 @@ public:
   KboWeightGenerationScheme kboWeightGenerationScheme() const { return _kboWeightGenerationScheme.actualValue; }
   bool kboMaxZero() const { return _kboMaxZero.actualValue; }
   const KboAdmissibilityCheck kboAdmissabilityCheck() const { return _kboAdmissabilityCheck.actualValue; }
+  unsigned groundOrderingCache() const { return _groundOrderingCache.actualValue; }
   const std::string& functionWeights() const { return _functionWeights.actualValue; }
   const std::string& predicateWeights() const { return _predicateWeights.actualValue; }
   const std::string& functionPrecedence() const { return _functionPrecedence.actualValue; }
@@ -2156,6 +2163,8 @@ public:
 #endif
   bool interactive() const { return _interactive.actualValue; }
   void setInteractive(bool v) { _interactive.actualValue = v; }
+  bool server() const { return _server.actualValue; }
+  void setServer(bool v) { _server.actualValue = v; }
   int inequalitySplitting() const { return _inequalitySplitting.actualValue; }
   int ageRatio() const { return _ageWeightRatio.actualValue; }
   void setAgeRatio(int v){ _ageWeightRatio.actualValue = v; }
@@ -2222,8 +2231,10 @@ public:
   void setQuestionAnswering(QuestionAnsweringMode newVal) { _questionAnswering.actualValue = newVal; }
   bool globalSubsumption() const { return _globalSubsumption.actualValue; }
   GlobalSubsumptionSatSolverPower globalSubsumptionSatSolverPower() const { return _globalSubsumptionSatSolverPower.actualValue; }
+  bool globalSubsumptionAdaptiveBudget() const { return _globalSubsumptionAdaptiveBudget.actualValue; }
   GlobalSubsumptionExplicitMinim globalSubsumptionExplicitMinim() const { return _globalSubsumptionExplicitMinim.actualValue; }
   GlobalSubsumptionAvatarAssumptions globalSubsumptionAvatarAssumptions() const { return _globalSubsumptionAvatarAssumptions.actualValue; }
+  bool globalSubsumptionSharedNaming() const { return _globalSubsumptionSharedNaming.actualValue; }
 
   /** true if calling set() on non-existing options does not result in a user error */
   IgnoreMissing ignoreMissing() const { return _ignoreMissing.actualValue; }
@@ -2246,6 +2257,7 @@ public:
   SineSelection sineSelection() const { return _sineSelection.actualValue; }
   void setSineSelection(SineSelection val) { _sineSelection.actualValue=val; }
   float sineTolerance() const { return _sineTolerance.actualValue; }
+  bool sineSharedIndex() const { return _sineSharedIndex.actualValue; }
   float sineToAgeTolerance() const { return _sineToAgeTolerance.actualValue; }
 
   bool colorUnblocking() const { return _colorUnblocking.actualValue; }
@@ -2286,8 +2298,18 @@ public:
   SplittingMinimizeModel splittingMinimizeModel() const { return _splittingMinimizeModel.actualValue; }
   SplittingLiteralPolarityAdvice splittingLiteralPolarityAdvice() const { return _splittingLiteralPolarityAdvice.actualValue; }
   SplittingDeleteDeactivated splittingDeleteDeactivated() const { return _splittingDeleteDeactivated.actualValue;}
+  /** The avatar_lazy_reinsertion cool-down, 0 when there is nothing to freeze as AVATAR is off or deletes deactivated clauses */
+  unsigned splittingLazyReinsertion() const
+  {
+    if (!_splitting.actualValue || _splittingDeleteDeactivated.actualValue == SplittingDeleteDeactivated::ON) {
+      return 0;
+    }
+    return _splittingLazyReinsertion.actualValue;
+  }
   bool splittingFastRestart() const { return _splittingFastRestart.actualValue; }
   bool splittingBufferedSolver() const { return _splittingBufferedSolver.actualValue; }
+  bool splittingModelReuse() const { return _splittingModelReuse.actualValue; }
+  bool splittingModelRepair() const { return _splittingModelRepair.actualValue; }
   int splittingFlushPeriod() const { return _splittingFlushPeriod.actualValue; }
   float splittingFlushQuotient() const { return _splittingFlushQuotient.actualValue; }
   float splittingAvatimer() const { return _splittingAvatimer.actualValue; }
@@ -2457,6 +2479,7 @@ private:
 
   ChoiceOptionValue<BadOption> _badOption;
   ChoiceOptionValue<Demodulation> _backwardDemodulation;
+  UnsignedOptionValue _backwardDemodulationBatch;
   ChoiceOptionValue<Subsumption> _backwardSubsumption;
   ChoiceOptionValue<Subsumption> _backwardSubsumptionResolution;
   BoolOptionValue _backwardSubsumptionDemodulation;
@@ -2488,6 +2511,8 @@ private:
   UnsignedOptionValue _fmbStartSize;
   FloatOptionValue _fmbSymmetryRatio;
   ChoiceOptionValue<FMBWidgetOrders> _fmbSymmetryWidgetOrders;
+  BoolOptionValue _fmbSymmetryDetection;
+  BoolOptionValue _fmbPruneInstances;
   ChoiceOptionValue<FMBSymbolOrders> _fmbSymmetryOrderSymbols;
   ChoiceOptionValue<FMBAdjustSorts> _fmbAdjustSorts;
   BoolOptionValue _fmbDetectSortBounds;
@@ -2495,6 +2520,8 @@ private:
   UnsignedOptionValue _fmbSizeWeightRatio;
   ChoiceOptionValue<FMBEnumerationStrategy> _fmbEnumerationStrategy;
   BoolOptionValue _fmbKeepSbeamGenerators;
+  BoolOptionValue _fmbIncremental;
+  UnsignedOptionValue _fmbWorkers;
 
   BoolOptionValue _flattenTopLevelConjunctions;
   StringOptionValue _forbiddenOptions;
@@ -2514,8 +2541,10 @@ private:
   BoolOptionValue _generalSplitting;
   BoolOptionValue _globalSubsumption;
   ChoiceOptionValue<GlobalSubsumptionSatSolverPower> _globalSubsumptionSatSolverPower;
+  BoolOptionValue _globalSubsumptionAdaptiveBudget;
   ChoiceOptionValue<GlobalSubsumptionExplicitMinim> _globalSubsumptionExplicitMinim;
   ChoiceOptionValue<GlobalSubsumptionAvatarAssumptions> _globalSubsumptionAvatarAssumptions;
+  BoolOptionValue _globalSubsumptionSharedNaming;
   ChoiceOptionValue<GoalGuess> _guessTheGoal;
   UnsignedOptionValue _guessTheGoalLimit;
 
@@ -2570,6 +2599,7 @@ private:
 
   ChoiceOptionValue<LiteralComparisonMode> _literalComparisonMode;
   IntOptionValue _lookaheadDelay;
+  UnsignedOptionValue _lookaheadCountReuse;
   IntOptionValue _lrsFirstTimeCheck;
   BoolOptionValue _lrsWeightLimitOnly;
   BoolOptionValue _lrsRetroactiveDeletes;
@@ -2583,6 +2613,7 @@ private:
   UnsignedOptionValue _memoryLimit; // should be size_t, making an assumption
 
   BoolOptionValue _interactive;
+  BoolOptionValue _server;
 
   ChoiceOptionValue<Mode> _mode;
   ChoiceOptionValue<Intent> _intent;
@@ -2676,6 +2707,7 @@ private:
   UnsignedOptionValue _sineToAgeGeneralityThreshold;
   ChoiceOptionValue<SineSelection> _sineSelection;
   FloatOptionValue _sineTolerance;
+  BoolOptionValue _sineSharedIndex;
   FloatOptionValue _sineToAgeTolerance;
   ChoiceOptionValue<Sos> _sos;
   UnsignedOptionValue _sosTheoryLimit;
@@ -2692,8 +2724,11 @@ private:
   ChoiceOptionValue<SplittingMinimizeModel> _splittingMinimizeModel;
   ChoiceOptionValue<SplittingLiteralPolarityAdvice> _splittingLiteralPolarityAdvice;
   ChoiceOptionValue<SplittingDeleteDeactivated> _splittingDeleteDeactivated;
+  UnsignedOptionValue _splittingLazyReinsertion;
   BoolOptionValue _splittingFastRestart;
   BoolOptionValue _splittingBufferedSolver;
+  BoolOptionValue _splittingModelReuse;
+  BoolOptionValue _splittingModelRepair;
 
   ChoiceOptionValue<Statistics> _statistics;
   BoolOptionValue _superpositionFromVariables;
@@ -2705,6 +2740,7 @@ private:
   ChoiceOptionValue<KboWeightGenerationScheme> _kboWeightGenerationScheme;
   BoolOptionValue _kboMaxZero;
   ChoiceOptionValue<KboAdmissibilityCheck> _kboAdmissabilityCheck;
+  UnsignedOptionValue _groundOrderingCache;
   StringOptionValue _functionWeights;
   StringOptionValue _predicateWeights;
   StringOptionValue _typeConPrecedence;
@@ -268,6 +268,147 @@ void SineBase::initGeneralityFunction(UnitList* units)
   }
 }
 
+//////////////////////////////////////
+// SineIndex
+//////////////////////////////////////
+
+/**
+ * Record that the generality of @b sym is about to change
+ */
+void SineIndex::touch(SymId sym)
+{
+  while (sym >= _symbols.size()) {
+    _symbols.push(SymbolEntry());
+  }
+  SymbolEntry& se = _symbols[sym];
+  _touched.insert(sym, se.gen);
+  se.sorted = false;
+}
+
+/**
+ * Recompute the least generality of the unit with index @b idx,
+ * invalidating the order of the occurrences of its symbols if it changed
+ */
+void SineIndex::updateLeastGen(unsigned idx)
+{
+  UnitEntry& ue = _units[idx];
+  ASS(ue.symbols.isNonEmpty());
+
+  unsigned leastGen = UINT_MAX;
+  for (SymId sym : ue.symbols) {
+    leastGen = min(leastGen, _symbols[sym].gen);
+  }
+  ASS_G(leastGen,0);
+  if (leastGen != ue.leastGen) {
+    ue.leastGen = leastGen;
+    for (SymId sym : ue.symbols) {
+      _symbols[sym].sorted = false;
+    }
+  }
+}
+
+void SineIndex::sortOccurrences(SymbolEntry& se)
+{
+  Stack<unsigned>& occ = se.occurrences;
+  unsigned liveCnt = 0;
+  for (unsigned idx : occ) {
+    if (_units[idx].live) {
+      occ[liveCnt++] = idx;
+    }
+  }
+  occ.truncate(liveCnt);
+  occ.sort([&](unsigned i1, unsigned i2) {
+    return _units[i1].leastGen > _units[i2].leastGen || (_units[i1].leastGen == _units[i2].leastGen && i1 < i2);
+  });
+  occ.dedup(); // a unit removed and added back since the last sort is listed twice
+  se.sorted = true;
+}
+
+/**
+ * Make the set of indexed units equal to @b units
+ *
+ * Symbols are only extracted from the units not indexed so far, and
+ * only the units which share a symbol with an added or removed unit
+ * have their least generality reconsidered.
+ */
+void SineIndex::sync(UnitList* units)
+{
+  TIME_TRACE(TimeTrace::SINE_SELECTION);
+
+  _stamp++;
+  _touched.reset();
+
+  UnitList::Iterator uit(units);
+  while (uit.hasNext()) {
+    Unit* u = uit.next();
+    unsigned* pidx;
+    if (_unitIndices.getValuePtr(u, pidx, _units.size())) {
+      UnitEntry ue { u, Stack<SymId>(), 0, false, 0 };
+      ue.symbols.loadFromIterator(_symExtr.extractSymIds(u));
+      _units.push(std::move(ue));
+    }
+    UnitEntry& ue = _units[*pidx];
+    if (ue.stamp == _stamp) {
+      continue; // listed twice
+    }
+    ue.stamp = _stamp;
+    if (!ue.live) {
+      ue.live = true;
+      ue.leastGen = 0;
+      for (SymId sym : ue.symbols) {
+        touch(sym);
+        _symbols[sym].gen++;
+        _symbols[sym].occurrences.push(*pidx);
+      }
+    }
+  }
+
+  for (unsigned idx = 0; idx < _units.size(); idx++) {
+    UnitEntry& ue = _units[idx];
+    if (ue.live && ue.stamp != _stamp) {
+      // removed (its entries in the occurrences get dropped at the next sort)
+      ue.live = false;
+      for (SymId sym : ue.symbols) {
+        touch(sym);
+        _symbols[sym].gen--;
+      }
+    }
+  }
+
+  // the least generality of a unit can only have changed if it contains a symbol
+  // which used to have exactly that generality, or which now has a smaller one
+  DHMap<SymId,unsigned>::Iterator tit(_touched);
+  while (tit.hasNext()) {
+    SymId sym;
+    unsigned oldGen;
+    tit.next(sym, oldGen);
+    unsigned gen = _symbols[sym].gen;
+    for (unsigned idx : _symbols[sym].occurrences) {
+      const UnitEntry& ue = _units[idx];
+      if (ue.live && (ue.leastGen == 0 || ue.leastGen == oldGen || gen < ue.leastGen)) {
+        updateLeastGen(idx);
+      }
+    }
+  }
+}
+
+/**
+ * Bring all symbol occurrences into their sorted form (e.g. before forking
+ * workers that will share the index)
+ */
+void SineIndex::sortAll()
+{
+  for (SymbolEntry& se : _symbols) {
+    if (!se.sorted) {
+      sortOccurrences(se);
+    }
+  }
+}
+
+//////////////////////////////////////
+// SineSelector
+//////////////////////////////////////
+
 SineSelector::SineSelector(const Options& opt)
 : _onIncluded(opt.sineSelection()==Options::SineSelection::INCLUDED),
   _genThreshold(opt.sineGeneralityThreshold()),
@@ -375,26 +516,38 @@ void SineSelector::updateDefRelation(Unit* u)
 
 void SineSelector::perform(Problem& prb)
 {
-  if (perform(prb.units())) {
+  if (perform(prb.units(), prb.sineIndex())) {
     prb.reportIncompleteTransformation();
   }
   prb.invalidateByRemoval();
 }
 
-bool SineSelector::perform(UnitList*& units)
+/**
+ * Select from @b units. If @b index is given, it is synced with @b units
+ * and used instead of computing the generality function and the D-relation
+ * from scratch (the result is the same).
+ */
+bool SineSelector::perform(UnitList*& units, SineIndex* index)
 {
   TIME_TRACE(TimeTrace::SINE_SELECTION);
 
-  initGeneralityFunction(units);
-
-  SymId symIdBound=_symExtr.getSymIdBound();
+  if (index) {
+    index->sync(units);
+  } else {
+    initGeneralityFunction(units);
+    _def.init(_symExtr.getSymIdBound(),0);
+  }
 
   Set<Unit*> selected;
   Stack<Unit*> selectedStack; //on this stack there are Units in the order they were selected
   Deque<Unit*> newlySelected;
 
+  // with the index, positions in units (of the indexed units), to order what a symbol triggers as _def would
+  DArray<unsigned> positions(index ? index->unitCnt() : 0);
+  // with the index, the D-relation is not consumed, so we need to remember the symbols we have been through
+  DHSet<SymId> visitedSymbols;
+
   //build the D-relation and select the non-axiom formulas
-  _def.init(symIdBound,0);
   unsigned numberUnitsLeftOut = 0;
   UnitList::Iterator uit2(units);
   while (uit2.hasNext()) {
@@ -402,10 +555,20 @@ bool SineSelector::perform(UnitList*& units)
     Unit* u=uit2.next();
     bool performSelection= _onIncluded ? u->included() : ((u->inputType()==UnitInputType::AXIOM)
                             || (env.options->guessTheGoal() != Options::GoalGuess::OFF && u->inputType()==UnitInputType::ASSUMPTION));
-    if (performSelection) { // register the unit for later
+    if (index) {
+      unsigned idx = index->unitIndex(u);
+      positions[idx] = numberUnitsLeftOut;
+      if (performSelection && index->symbols(idx).isEmpty()) {
+        if(_justForSineLevels){
+          u->inference().setSineLevel(0);
+        }
+        _unitsWithoutSymbols.push(u);
+      }
+    }
+    else if (performSelection) { // register the unit for later
       updateDefRelation(u);
     }
-    else { // goal units are immediately taken (well, non-axiom, to by more precise. Includes ASSUMPTION, which cl->isGoal() does not take into account)
+    if (!performSelection) { // goal units are immediately taken (well, non-axiom, to by more precise. Includes ASSUMPTION, which cl->isGoal() does not take into account)
       selected.insert(u);
       selectedStack.push(u);
       newlySelected.push_back(u);
@@ -417,6 +580,20 @@ bool SineSelector::perform(UnitList*& units)
     }
   }
 
+  auto select = [&](Unit* du) {
+    if (selected.contains(du)) {
+      return;
+    }
+    selected.insert(du);
+    selectedStack.push(du);
+    newlySelected.push_back(du);
+
+    if(_justForSineLevels){
+      du->inference().setSineLevel(env.maxSineLevel);
+      //cout << "set level for " << du->toString() << " in iteration as " << env.maxClausePriority << endl;
+    }
+  };
+
   unsigned depth=0;
   newlySelected.push_back(0);
 
@@ -448,10 +625,7 @@ bool SineSelector::perform(UnitList*& units)
       continue;
     }
 
-    SymIdIterator sit=_symExtr.extractSymIds(u);
-    while (sit.hasNext()) {
-      SymId sym=sit.next();
-
+    auto selectTriggered = [&](SymId sym) {
       if (env.predicateSineLevels) {
         bool pred;
         unsigned functor;
@@ -462,25 +636,40 @@ bool SineSelector::perform(UnitList*& units)
         }
       }
 
-      UnitList::Iterator defUnits(_def[sym]);
-      while (defUnits.hasNext()) {
-        Unit* du=defUnits.next();
-        if (selected.contains(du)) {
-          continue;
+      if (index) {
+        if (!visitedSymbols.insert(sym)) {
+          return;
         }
-        selected.insert(du);
-        selectedStack.push(du);
-        newlySelected.push_back(du);
-
-        if(_justForSineLevels){
-          du->inference().setSineLevel(env.maxSineLevel);
-          //cout << "set level for " << du->toString() << " in iteration as " << env.maxClausePriority << endl;
+        static Stack<unsigned> triggered;
+        triggered.reset();
+        index->forEachTriggered(sym, _tolerance, _genThreshold, [&](unsigned idx) { triggered.push(idx); });
+        // _def lists the units in the reverse order of units
+        triggered.sort([&](unsigned i1, unsigned i2) { return positions[i1] > positions[i2]; });
+        for (unsigned idx : triggered) {
+          select(index->unit(idx));
         }
+        return;
+      }
+
+      UnitList::Iterator defUnits(_def[sym]);
+      while (defUnits.hasNext()) {
+        select(defUnits.next());
       }
       //all defining units for the symbol sym were selected,
       //so we can remove them from the relation
       UnitList::destroy(_def[sym]);
       _def[sym]=0;
+    };
+
+    if (index) {
+      for (SymId sym : index->symbols(index->unitIndex(u))) {
+        selectTriggered(sym);
+      }
+    } else {
+      SymIdIterator sit=_symExtr.extractSymIds(u);
+      while (sit.hasNext()) {
+        selectTriggered(sit.next());
+      }
     }
   }
 
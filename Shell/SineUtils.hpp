@@ -18,6 +18,7 @@
 #include "Forwards.hpp"
 
 #include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Stack.hpp"
 
 namespace Shell {
@@ -58,6 +59,93 @@ protected:
   SineSymbolExtractor _symExtr;
 };
 
+/**
+ * SInE index over a set of units, which can be shared among selections
+ * with different tolerance, depth and generality threshold settings
+ *
+ * For each unit, we store its symbols and the generality of its least
+ * general symbol. For each symbol, we store its generality and the units
+ * it occurs in, sorted by the generality of their least general symbol
+ * in descending order. As the generality of the symbol itself is fixed,
+ * the units the symbol triggers under any tolerance form a prefix of this
+ * sequence, so a selection takes time proportional to what gets selected.
+ *
+ * The indexed set of units can be changed by @b sync(), which only
+ * recomputes what is affected by the added and removed units.
+ */
+class SineIndex
+{
+public:
+  typedef SineSymbolExtractor::SymId SymId;
+
+  void sync(UnitList* units);
+  void sortAll();
+
+  /** Index of the unit @b u, which must be among the indexed units */
+  unsigned unitIndex(Unit* u) const { return _unitIndices.get(u); }
+  Unit* unit(unsigned idx) const { return _units[idx].unit; }
+  /** Symbols of the unit with index @b idx, sorted and without duplicates */
+  const Stack<SymId>& symbols(unsigned idx) const { return _units[idx].symbols; }
+  unsigned unitCnt() const { return _units.size(); }
+
+  /**
+   * Call @b fn on the index of each unit which symbol @b sym triggers
+   * under the given @b tolerance and @b genThreshold (cf. SineSelector)
+   */
+  template<class Fn>
+  void forEachTriggered(SymId sym, float tolerance, unsigned genThreshold, Fn fn)
+  {
+    if (sym >= _symbols.size()) {
+      return;
+    }
+    SymbolEntry& se = _symbols[sym];
+    if (!se.sorted) {
+      sortOccurrences(se);
+    }
+    bool all = se.gen <= genThreshold || tolerance == -1.0f;
+    for (unsigned idx : se.occurrences) {
+      if (!all && se.gen > static_cast<unsigned>(static_cast<int>(_units[idx].leastGen*tolerance))) {
+        break;
+      }
+      fn(idx);
+    }
+  }
+
+private:
+  struct UnitEntry {
+    Unit* unit;
+    Stack<SymId> symbols;
+    /** generality of the least general symbol of the unit (0 if not computed yet) */
+    unsigned leastGen;
+    bool live;
+    /** the last sync in which the unit was seen */
+    unsigned stamp;
+  };
+  struct SymbolEntry {
+    unsigned gen = 0;
+    /**
+     * Indices of the units the symbol occurs in. If @b sorted, these are just the live ones,
+     * in descending order of their @b leastGen
+     */
+    Stack<unsigned> occurrences;
+    bool sorted = true;
+  };
+
+  void touch(SymId sym);
+  void updateLeastGen(unsigned idx);
+  void sortOccurrences(SymbolEntry& se);
+
+  Stack<UnitEntry> _units;
+  DHMap<Unit*,unsigned> _unitIndices;
+  Stack<SymbolEntry> _symbols;
+  unsigned _stamp = 0;
+
+  /** symbols whose generality changed in the current sync, with their previous generality */
+  DHMap<SymId,unsigned> _touched;
+
+  SineSymbolExtractor _symExtr;
+};
+
 /**
  * Class that performs the SInE axiom selection on a single problem
  */
@@ -69,7 +157,7 @@ public:
   SineSelector(bool onIncluded, float tolerance, unsigned depthLimit,
       unsigned genThreshold=0, bool justForSineLevels=false);
 
-  bool perform(UnitList*& units); // returns true iff removed something
+  bool perform(UnitList*& units, SineIndex* index=nullptr); // returns true iff removed something
   void perform(Problem& prb);
 
   ~SineSelector() {
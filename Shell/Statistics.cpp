@@ -179,10 +179,28 @@ Statistics::Statistics()
 
     satSplits(0),
     satSplitRefutations(0),
+    satSplitModelsReused(0),
+    satSplitComponentsActivated(0),
+    satSplitComponentsDeactivated(0),
+    satSplitClausesRemoved(0),
+    satSplitActiveClausesUnindexed(0),
+    satSplitActiveClausesFrozen(0),
+    satSplitReinsertionsAvoided(0),
+    satSplitClausesRestored(0),
 
     smtFallbacks(0),
 
+    fmbSymmetricConstants(0),
+    fmbSymmetryBreakingClauses(0),
+
     satPureVarsEliminated(0),
+    groundOrderingCacheHits(0),
+    groundOrderingCacheMisses(0),
+    uwaAbstractionAttempts(0),
+    uwaAbstractionCacheHits(0),
+    uwaAbstractionsEqualIf(0),
+    uwaAbstractionsNeverEqual(0),
+    uwaAbstractionConstraints(0),
     terminationReason(UNKNOWN),
     refutation(0),
     saturatedSet(0),
@@ -451,16 +469,28 @@ void Statistics::print(std::ostream& out)
   COND_OUT("Disequalities generated from acyclicity",taAcyclicityGeneratedDisequalities);
 
   HEADING("AVATAR",splitClauses+splitComponents+uniqueComponents+satSplits+
-        satSplitRefutations);
+        satSplitRefutations+satSplitModelsReused+satSplitComponentsActivated+
+        satSplitComponentsDeactivated);
   COND_OUT("Split clauses", splitClauses);
   COND_OUT("Split components", splitComponents);
   COND_OUT("Unique components", uniqueComponents);
   //COND_OUT("Sat splits", satSplits); // same as split clauses
   COND_OUT("Sat splitting refutations", satSplitRefutations);
+  COND_OUT("Models reused without SAT call", satSplitModelsReused);
+  COND_OUT("Components activated", satSplitComponentsActivated);
+  COND_OUT("Components deactivated", satSplitComponentsDeactivated);
+  COND_OUT("Clauses removed by deactivation", satSplitClausesRemoved);
+  COND_OUT("Active clauses unindexed by deactivation", satSplitActiveClausesUnindexed);
+  COND_OUT("Active clauses frozen by deactivation", satSplitActiveClausesFrozen);
+  COND_OUT("Index reinsertions avoided", satSplitReinsertionsAvoided);
+  COND_OUT("Clauses restored by model updates", satSplitClausesRestored);
   COND_OUT("SMT fallbacks",smtFallbacks);
   SEPARATOR;
 
-  //TODO record statistics for FMB
+  HEADING("Finite Model Building",fmbSymmetricConstants+fmbSymmetryBreakingClauses);
+  COND_OUT("Interchangeable constants", fmbSymmetricConstants);
+  COND_OUT("Symmetry breaking clauses for them", fmbSymmetryBreakingClauses);
+  SEPARATOR;
 
   //TODO record statistics for MiniSAT
   HEADING("SAT Solver Statistics",satClauses+unitSatClauses+binarySatClauses+satPureVarsEliminated);
@@ -470,6 +500,31 @@ void Statistics::print(std::ostream& out)
   COND_OUT("Pure propositional variables eliminated by SAT solver", satPureVarsEliminated);
   SEPARATOR;
 
+#define SAT_CALLS_OUT(text, st) if ((st).calls) { addCommentSignForSZS(out); out << text << ": " << (st).calls \
+    << " (unsat " << (st).unsatisfiable << ", unknown " << (st).unknown << ", conflicts " << (st).conflicts \
+    << ", propagations " << (st).propagations << ", learned at most " << (st).maxLearnedClauses \
+    << ", " << (st).nanoseconds/1000000 << " ms)" << endl; separable = true; }
+  HEADING("SAT Solver Calls",splitterSatCalls.calls+gsSatCalls.calls+gsMinimizationSatCalls.calls+fmbSatCalls.calls);
+  SAT_CALLS_OUT("AVATAR", splitterSatCalls);
+  SAT_CALLS_OUT("Global subsumption", gsSatCalls);
+  SAT_CALLS_OUT("Global subsumption minimization", gsMinimizationSatCalls);
+  SAT_CALLS_OUT("Finite model building", fmbSatCalls);
+  SEPARATOR;
+#undef SAT_CALLS_OUT
+
+  HEADING("Term Ordering",groundOrderingCacheHits+groundOrderingCacheMisses);
+  COND_OUT("Ground comparison cache hits", groundOrderingCacheHits);
+  COND_OUT("Ground comparison cache misses", groundOrderingCacheMisses);
+  SEPARATOR;
+
+  HEADING("Unification with Abstraction",uwaAbstractionAttempts);
+  COND_OUT("Abstraction attempts", uwaAbstractionAttempts);
+  COND_OUT("Abstraction cache hits", uwaAbstractionCacheHits);
+  COND_OUT("Abstractions with constraints", uwaAbstractionsEqualIf);
+  COND_OUT("Abstractions to never equal", uwaAbstractionsNeverEqual);
+  COND_OUT("Abstraction constraints", uwaAbstractionConstraints);
+  SEPARATOR;
+
   }
 
   addCommentSignForSZS(out);
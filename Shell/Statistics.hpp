@@ -17,6 +17,7 @@
 #ifndef __Statistics__
 #define __Statistics__
 
+#include <cstdint>
 #include <ostream>
 
 #include "Forwards.hpp"
@@ -33,6 +34,30 @@ namespace Shell {
 
 using namespace Kernel;
 
+/**
+ * Counters of the SAT solver calls made from one place in the prover
+ * (conflicts, propagations and learned clauses only for solvers reporting them)
+ */
+struct SATCallStatistics {
+  SATCallStatistics()
+    : calls(0), unsatisfiable(0), unknown(0), conflicts(0), propagations(0), maxLearnedClauses(0), nanoseconds(0) {}
+
+  /** number of solver calls */
+  unsigned calls;
+  /** calls that ended UNSATISFIABLE */
+  unsigned unsatisfiable;
+  /** calls that ran out of their conflict budget */
+  unsigned unknown;
+  /** conflicts encountered in the calls */
+  uint64_t conflicts;
+  /** propagations done in the calls */
+  uint64_t propagations;
+  /** largest learned clause database seen after a call */
+  unsigned maxLearnedClauses;
+  /** time spent in the calls */
+  uint64_t nanoseconds;
+};
+
 /**
  * Class Statistics
  * @since 02/01/2008 Manchester
@@ -279,12 +304,58 @@ public:
 
   unsigned satSplits;
   unsigned satSplitRefutations;
+  /** Number of times the AVATAR model was kept without calling the SAT solver */
+  unsigned satSplitModelsReused;
+  /** Number of AVATAR components switched on by model updates */
+  unsigned satSplitComponentsActivated;
+  /** Number of AVATAR components switched off by model updates */
+  unsigned satSplitComponentsDeactivated;
+  /** Number of clauses taken out of the search space by deactivated components */
+  unsigned satSplitClausesRemoved;
+  /** Number of those that were active, i.e. had to be taken out of the indices */
+  unsigned satSplitActiveClausesUnindexed;
+  /** Number of those that were active but were kept in the generating indices (frozen) */
+  unsigned satSplitActiveClausesFrozen;
+  /** Number of frozen clauses activated again without being inserted into those indices */
+  unsigned satSplitReinsertionsAvoided;
+  /** Number of clauses put back (restored or unfrozen) by model updates */
+  unsigned satSplitClausesRestored;
 
   unsigned smtFallbacks;
 
+  /** Number of constants FMB found to be interchangeable with another one */
+  unsigned fmbSymmetricConstants;
+  /** Number of SAT clauses FMB added to order the values of interchangeable constants */
+  unsigned fmbSymmetryBreakingClauses;
+
   /** Number of pure variables eliminated by SAT solver */
   unsigned satPureVarsEliminated;
 
+  /** SAT solver calls of the AVATAR splitter */
+  SATCallStatistics splitterSatCalls;
+  /** SAT solver calls of global subsumption */
+  SATCallStatistics gsSatCalls;
+  /** SAT solver calls minimizing the assumptions found by global subsumption */
+  SATCallStatistics gsMinimizationSatCalls;
+  /** SAT solver calls of the finite model builder */
+  SATCallStatistics fmbSatCalls;
+
+  /** Comparisons of ground terms answered from the ordering's cache */
+  unsigned groundOrderingCacheHits;
+  /** Comparisons of ground terms not found in the ordering's cache */
+  unsigned groundOrderingCacheMisses;
+
+  /** Calls of the unification with abstraction oracle */
+  unsigned uwaAbstractionAttempts;
+  /** Abstractions answered from the cache of ground term pairs */
+  unsigned uwaAbstractionCacheHits;
+  /** Abstractions that succeeded under some constraints */
+  unsigned uwaAbstractionsEqualIf;
+  /** Abstractions that showed the terms are never equal */
+  unsigned uwaAbstractionsNeverEqual;
+  /** Total number of constraints introduced by abstractions */
+  unsigned uwaAbstractionConstraints;
+
   /** termination reason */
   enum TerminationReason {
     /** refutation found */
@@ -466,6 +466,31 @@ std::string TPTPPrinter::toString(const Formula* formula)
   return res;
 }
 
+/**
+ * Return the TPTP role of @b unit and set @b negateFormula to true iff
+ * the unit is a formula that should be printed negated.
+ */
+static const char* unitKind(const Unit* unit, bool& negateFormula)
+{
+  negateFormula = false;
+  switch (unit->inputType()) {
+  case UnitInputType::ASSUMPTION:
+    return "hypothesis";
+  case UnitInputType::CONJECTURE:
+    if(unit->isClause()) {
+      return "negated_conjecture";
+    }
+    negateFormula = true;
+    return "conjecture";
+  case UnitInputType::EXTENSIONALITY_AXIOM:
+    return "extensionality";
+  case UnitInputType::NEGATED_CONJECTURE:
+    return "negated_conjecture";
+  default:
+    return "axiom";
+  }
+}
+
 /**
  * Output unit @param unit in TPTP format as a std::string
  *
@@ -482,35 +507,8 @@ std::string TPTPPrinter::toString (const Unit* unit)
   std::string prefix;
   std::string main = "";
 
-  bool negate_formula = false;
-  std::string kind;
-  switch (unit->inputType()) {
-  case UnitInputType::ASSUMPTION:
-    kind = "hypothesis";
-    break;
-
-  case UnitInputType::CONJECTURE:
-    if(unit->isClause()) {
-      kind = "negated_conjecture";
-    }
-    else {
-      negate_formula = true;
-      kind = "conjecture";
-    }
-    break;
-
-  case UnitInputType::EXTENSIONALITY_AXIOM:
-    kind = "extensionality";
-    break;
-
-  case UnitInputType::NEGATED_CONJECTURE:
-    kind = "negated_conjecture";
-    break;
-
-  default:
-    kind = "axiom";
-    break;
-  }
+  bool negate_formula;
+  std::string kind = unitKind(unit, negate_formula);
 
   if (unit->isClause()) {
     prefix = "cnf";
@@ -556,6 +554,69 @@ std::string TPTPPrinter::toString (const Unit* unit)
 }
 
 
+/**
+ * Append unit @b u to the buffer, in the same format as
+ * TPTPPrinter::toString(const Unit*)
+ */
+void TPTPWriter::write(const Unit* u)
+{
+  if (!u->isClause()) {
+    _buf += TPTPPrinter::toString(u);
+    flushIfFull();
+    return;
+  }
+
+  const Clause* cl = static_cast<const Clause*>(u);
+  bool negate;
+  _buf += "cnf(";
+  std::string unitName;
+  if (Parse::TPTP::findAxiomName(u, unitName)) {
+    _buf += unitName;
+  } else {
+    _buf += 'u';
+    _buf += Int::toString(u->number());
+  }
+  _buf += ',';
+  _buf += unitKind(u, negate);
+  _buf += ",\n    ";
+  if (cl->isEmpty()) {
+    _buf += "$false";
+  }
+  for (unsigned i = 0; i < cl->length(); i++) {
+    if (i) {
+      _buf += " | ";
+    }
+    appendLiteral((*cl)[i]);
+  }
+  _buf += ").\n";
+  flushIfFull();
+}
+
+void TPTPWriter::appendLiteral(Literal* l)
+{
+  if (!l->shared()) {
+    _buf += l->toString();
+    return;
+  }
+  if (_literalStrings.size() >= LITERAL_MEMO_SIZE) {
+    _literalStrings.reset();
+  }
+  std::string* str;
+  if (_literalStrings.getValuePtr(l, str)) {
+    *str = l->toString();
+  }
+  _buf += *str;
+}
+
+/**
+ * Write the buffered output to the stream
+ */
+void TPTPWriter::flush()
+{
+  _out.write(_buf.data(), _buf.size());
+  _buf.clear();
+}
+
 std::string TPTPPrinter::toString(const Term* t){
   NOT_IMPLEMENTED;
 }
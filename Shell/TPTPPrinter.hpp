@@ -16,9 +16,12 @@
 #define __TPTPPrinter__
 
 #include <iosfwd>
+#include <string>
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
+
 
 
 namespace Shell {
@@ -61,6 +64,38 @@ private:
   bool _headersPrinted;
 };
 
+/**
+ * Buffered output of units in the format of TPTPPrinter::toString(const Unit*)
+ *
+ * Clauses are rendered directly into a large buffer, which is written to the
+ * output stream only when it fills up or on @b flush(), and the strings of
+ * shared literals are memoised, as they tend to repeat across the clauses.
+ * Meant for printing many units at once, as in the clausify mode or when
+ * printing a saturated set.
+ */
+class TPTPWriter {
+public:
+  TPTPWriter(std::ostream& out) : _out(out) { _buf.reserve(BUFFER_SIZE); }
+  ~TPTPWriter() { flush(); }
+
+  void write(const Unit* u);
+  void write(const std::string& s) { _buf += s; flushIfFull(); }
+  void flush();
+
+private:
+  /** size of the buffer at which it is written out */
+  static const size_t BUFFER_SIZE = 1 << 20;
+  /** number of memoised literal strings at which the memo is dropped */
+  static const unsigned LITERAL_MEMO_SIZE = 1 << 16;
+
+  void appendLiteral(Literal* l);
+  void flushIfFull() { if (_buf.size() >= BUFFER_SIZE) { flush(); } }
+
+  std::ostream& _out;
+  std::string _buf;
+  DHMap<Literal*, std::string> _literalStrings;
+};
+
 }
 
 #endif // __TPTPPrinter__
@@ -181,10 +181,14 @@ void UIHelper::outputSaturatedSet(std::ostream& out, UnitIterator uit)
   addCommentSignForSZS(out);
   out << "# SZS output start Saturation." << endl;
 
+  TPTPWriter writer(out);
   while (uit.hasNext()) {
     Unit* cl = uit.next();
-    out << TPTPPrinter::toString(cl) << endl;
+    writer.write(cl);
+    writer.write("\n");
   }
+  writer.flush();
+  out.flush();
 
   addCommentSignForSZS(out);
   out << "# SZS output end Saturation." << endl;
@@ -389,6 +393,30 @@ Problem* UIHelper::getInputProblem()
   return res;
 }
 
+/**
+ * Like getInputProblem, but extend @b base, a problem obtained from the previous
+ * loaded piece, by the units parsed in the topmost loaded piece only.
+ *
+ * The list of @b base must not share its cells with the loaded pieces
+ * (it should be a copy). If the property of @b base is up to date, it is
+ * updated incrementally rather than recomputed from scratch. This is used
+ * by the server metamode, where @b base is the axiom base.
+ */
+Problem* UIHelper::getInputProblemOver(Problem* base)
+{
+  ASS_G(_loadedPieces.size(),1);
+  const LoadedPiece& below = _loadedPieces[_loadedPieces.size()-2];
+  const LoadedPiece& top = _loadedPieces.top();
+
+  // top was copied from below and extended at the back, which linked the new cells
+  // behind below's last cell (so below's list runs into them, see popLoadedPiece)
+  UnitList* added = below._units.empty() ? top._units.list() : below._units.lastCell()->tail();
+  base->addUnits(UnitList::copy(added));
+
+  env.setMainProblem(base);
+  return base;
+}
+
 void UIHelper::listLoadedPieces(std::ostream& out)
 {
   auto it = _loadedPieces.iterFifo();
@@ -55,6 +55,7 @@ public:
   static void parseFile(const std::string& inputFile, Options::InputSyntax inputSyntax, bool verbose);
 
   static Problem* getInputProblem();
+  static Problem* getInputProblemOver(Problem* base);
 
   static void listLoadedPieces(std::ostream& out);
   static void popLoadedPiece(int numPops);
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+#include "Test/TestUtils.hpp"
+#include "Test/MockedSaturationAlgorithm.hpp"
+
+#include "Kernel/Problem.hpp"
+#include "Kernel/Ordering.hpp"
+#include "Lib/SharedSet.hpp"
+#include "Shell/Options.hpp"
+
+#include "Indexing/TermIndex.hpp"
+#include "Indexing/TermSubstitutionTree.hpp"
+#include "Inferences/BackwardDemodulation.hpp"
+
+using namespace Test;
+using namespace Inferences;
+
+/**
+ * A batched sweep rewrites with equations collected at earlier activations,
+ * so its records must name those equations as premises rather than the
+ * clause whose activation triggered the sweep (they may depend on different splits).
+ */
+TEST_FUN(batched_sweep_premises) {
+  DECL_SORT(s)
+  DECL_FUNC(f, {s}, s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+
+  Clause* target = clause({ p(f(a)) });
+  Clause* eq     = clause({ f(a) == a });
+  Clause* other  = clause({ q(b) });
+  target->setSplits(SplitSet::getSingleton(0));
+  eq->setSplits(SplitSet::getSingleton(1));
+  other->setSplits(SplitSet::getSingleton(2));
+
+  Problem prb;
+  env.setMainProblem(&prb);
+  delete env.options;
+  env.options = new Options;
+  env.options->set("backward_demodulation_batch", "2");
+  env.options->resolveAwayAutoValues0();
+  env.options->resolveAwayAutoValues(prb);
+  MockedSaturationAlgorithm alg(prb, *env.options);
+
+  DemodulationSubtermIndexImpl<false> index(new TermSubstitutionTree<TermLiteralClause>(), *env.options);
+  index.attachContainer(alg.getSimplifyingClauseContainer());
+
+  BackwardDemodulation bd;
+  bd.InferenceEngine::attach(&alg);
+  bd.setTestIndices({ &index });
+  target->setStore(Clause::ACTIVE);
+  alg.getSimplifyingClauseContainer()->add(target);
+
+  // the equation is only collected ...
+  BwSimplificationRecordIterator simpls;
+  eq->setStore(Clause::ACTIVE);
+  bd.perform(eq, simpls);
+  ASS(!simpls.hasNext());
+
+  // ... and used by the sweep triggered by the next activation
+  other->setStore(Clause::ACTIVE);
+  bd.perform(other, simpls);
+  ASS(simpls.hasNext());
+  BwSimplificationRecord rec = simpls.next();
+  ASS(!simpls.hasNext());
+
+  ASS_EQ(rec.toRemove, target);
+  ASS_EQ(rec.premise, eq);
+  ASS(TestUtils::eqModAC(rec.replacement, clause({ p(a) })));
+
+  bd.InferenceEngine::detach();
+  Ordering::unsetGlobalOrdering();
+}
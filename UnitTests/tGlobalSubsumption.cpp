@@ -0,0 +1,123 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+#include "Test/MockedSaturationAlgorithm.hpp"
+
+#include "Kernel/Problem.hpp"
+#include "Kernel/Ordering.hpp"
+#include "Lib/SharedSet.hpp"
+#include "Shell/Options.hpp"
+#include "Saturation/Splitter.hpp"
+
+#include "Inferences/GlobalSubsumption.hpp"
+
+using namespace Test;
+using namespace Inferences;
+using namespace Saturation;
+
+namespace {
+
+class SplittingAlgorithm : public MockedSaturationAlgorithm {
+public:
+  SplittingAlgorithm(Problem& p, Options& o) : MockedSaturationAlgorithm(p,o)
+  {
+    _splitter = new Splitter();
+    _splitter->init(this);
+  }
+};
+
+SplitLevel levelOf(Splitter& splitter, Literal* lit)
+{
+  for (SplitLevel lev = 0; lev < splitter.splitLevelBound(); lev++) {
+    if (splitter.isUsedName(lev)) {
+      Clause* comp = splitter.getComponentClause(lev);
+      if (comp->length() == 1 && (*comp)[0] == lit) {
+        return lev;
+      }
+    }
+  }
+  ASSERTION_VIOLATION
+}
+
+}
+
+/**
+ * With shared naming, the literal of a named level can be derived by propagation
+ * instead of being assumed. A premise depending on such a level must still pass
+ * the level on to the replacement.
+ */
+TEST_FUN(shared_naming_keeps_propagated_levels) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_CONST(c, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+  DECL_PRED(r, {s})
+  DECL_PRED(t, {s})
+
+  Problem prb;
+  env.setMainProblem(&prb);
+  delete env.options;
+  env.options = new Options;
+  env.options->set("global_subsumption", "on");
+  env.options->set("global_subsumption_avatar_assumptions", "from_current");
+  env.options->set("global_subsumption_shared_naming", "on");
+  env.options->set("avatar_nonsplittable_components", "all");
+  env.options->resolveAwayAutoValues0();
+  env.options->resolveAwayAutoValues(prb);
+  SplittingAlgorithm alg(prb, *env.options);
+  Splitter& splitter = *alg.getSplitter();
+
+  // name the ground component p(a) and the non-ground one r(x), and make both active
+  for (Clause* cl : { clause({ p(a) }), clause({ r(x) }) }) {
+    cl->setSplits(SplitSet::getEmpty());
+    ALWAYS(splitter.doSplitting(cl));
+  }
+  splitter.onAllProcessed();
+  SplitLevel lev = levelOf(splitter, p(a));
+  SplitLevel s2 = levelOf(splitter, r(x));
+  ASS(splitter.splitLevelActive(lev));
+  ASS(splitter.splitLevelActive(s2));
+
+  GlobalSubsumption gs(*env.options);
+  gs.attach(&alg);
+
+  Stack<Unit*> prems;
+
+  // p(a) becomes a unit of the GS solver, so its literal need not be assumed below
+  Clause* unit = clause({ p(a) });
+  unit->setSplits(SplitSet::getEmpty());
+  ASS_EQ(gs.perform(unit, prems), unit);
+
+  Clause* prem = clause({ q(b) });
+  prem->setSplits(SplitSet::getSingleton(lev)->getUnion(SplitSet::getSingleton(s2)));
+  ASS_EQ(gs.perform(prem, prems), prem);
+
+  Clause* cl = clause({ q(b), t(c) });
+  cl->setSplits(SplitSet::getSingleton(s2));
+  Clause* replacement = gs.perform(cl, prems);
+
+  ASS_NEQ(replacement, cl);
+  ASS_EQ(replacement->length(), 1);
+  ASS_EQ((*replacement)[0], (Literal*)q(b));
+  ASS(prems.find(prem));
+
+  // the replacement depends on both levels of the premise
+  splitter.onNewClause(replacement);
+  ASS(replacement->splits()->member(lev));
+  ASS(replacement->splits()->member(s2));
+
+  gs.detach();
+  Ordering::unsetGlobalOrdering();
+}
@@ -591,3 +591,22 @@ TEST_FUN(kbo_isGreater_test17) {
     f(g(y,f(g(x,g(y,z)))))));
 }
 
+
+TEST_FUN(kbo_large_variables) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(srt)
+  DECL_FUNC(f, {srt}, srt)
+  DECL_FUNC(g, {srt, srt}, srt)
+  // variables with large numbers are not counted in the dense array
+  DECL_VAR(u, 100)
+  DECL_VAR(v, 101)
+
+  auto ord = kbo(1, 1, weights(), weights());
+
+  ASS_EQ(ord.compare(g(f(x),u), g(x,u)), Ordering::Result::GREATER)
+  ASS_EQ(ord.compare(g(x,u), g(x,v)), Ordering::Result::INCOMPARABLE)
+  ASS_EQ(ord.compare(g(y,u), f(g(u,y))), Ordering::Result::LESS)
+  ASS_EQ(ord.compare(f(u), u), Ordering::Result::GREATER)
+  ASS_EQ(ord.compare(f(x), y), Ordering::Result::INCOMPARABLE)
+  ASS_EQ(ord.compare(g(u,x), g(x,u)), Ordering::Result::INCOMPARABLE)
+}
@@ -28,3 +28,29 @@ TEST_FUN(test_match1) {
   check(f(f(a, y), f(x, b)), f(f(a,b),f(a,b)));
 
 }
+
+TEST_FUN(test_unify_backtrack) {
+  DECL_DEFAULT_VARS
+  DECL_VAR(big, 5000)
+  DECL_SORT(s);
+  DECL_FUNC(f, {s, s}, s);
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+
+  RobSubstitution subs;
+  ASS(!subs.unify(f(x, x), 0, f(a, b), 1))
+  ASS(subs.isEmpty())
+
+  BacktrackData bd;
+  subs.bdRecord(bd);
+  ASS(subs.unify(f(x, y), 0, f(a, x), 1))
+  ASS(subs.unify(big, 0, f(y, b), 1))
+  subs.bdDone();
+  ASS_EQ(subs.apply(TermList(x), 0), TermList(a))
+  ASS_EQ(subs.apply(TermList(big), 0), subs.apply(TermList(f(y, b)), 1))
+
+  bd.backtrack();
+  ASS(subs.isEmpty())
+  ASS(subs.unify(f(big, a), 0, f(b, x), 0))
+  ASS_EQ(subs.apply(TermList(big), 0), TermList(b))
+}
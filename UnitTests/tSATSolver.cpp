@@ -12,11 +12,14 @@
 #include "Lib/Stack.hpp"
 #include "Lib/Environment.hpp"
 
+#include "SAT/SATCallMonitoring.hpp"
 #include "SAT/SATClause.hpp"
+#include "SAT/SATClauseArena.hpp"
 #include "SAT/SATLiteral.hpp"
 #include "SAT/SATInference.hpp"
 #include "SAT/SATSolver.hpp"
 #include "SAT/MinisatInterfacing.hpp"
+#include "SAT/MinisatInterfacingNewSimp.hpp"
 #include "SAT/Z3Interfacing.hpp"
 
 #include "Test/UnitTesting.hpp"
@@ -289,3 +292,68 @@ TEST_FUN(testSolvingUnderAssumptions)
     testAssumptions(sZ3);
   }*/
 }
+
+bool addToArena(SATClauseArena& arena, const char* spec)
+{
+  SATLiteralStack lits;
+  while(*spec) {
+    lits.push(getLit(*spec));
+    spec++;
+  }
+  return arena.add(lits);
+}
+
+void testArena(SATSolver& s, SATClauseArena& arena)
+{
+  ensurePrepared(s);
+  s.addClauses(arena);
+  ASS_EQ(s.solve(),SATSolver::Status::UNSATISFIABLE);
+}
+
+TEST_FUN(testClauseArena)
+{
+  SATClauseArena arena;
+  ASS(addToArena(arena,"aab"));
+  ASS(!addToArena(arena,"cC"));
+  ASS(addToArena(arena,"A"));
+  ASS(addToArena(arena,"BcB"));
+  ASS(addToArena(arena,"C"));
+
+  ASS_EQ(arena.size(),4u);
+  ASS_EQ(arena.length(0),2u);
+  ASS_EQ(arena.length(1),1u);
+  ASS_EQ(arena.length(2),2u);
+  ASS_EQ(arena.literals(1)[0],getLit('A'));
+
+  // through the SATClause objects
+  MinisatInterfacing sMini(*env.options,true);
+  testArena(sMini,arena);
+
+  // straight from the arena
+  MinisatInterfacingNewSimp sSimp(*env.options,true);
+  testArena(sSimp,arena);
+}
+
+TEST_FUN(testAdaptiveConflictBudget)
+{
+  AdaptiveConflictBudget budget(UINT_MAX);
+  ASS_EQ(budget.limit(),UINT_MAX);
+
+  // an unproductive window falls below the most conflicts seen
+  for (unsigned i = 0; i < 64; i++) {
+    budget.record(false, i == 7 ? 100 : 3);
+  }
+  ASS_EQ(budget.limit(),50u);
+
+  // a productive one grows it again
+  for (unsigned i = 0; i < 64; i++) {
+    budget.record(i % 4 == 0, 10);
+  }
+  ASS_EQ(budget.limit(),100u);
+
+  // down to propagation only
+  for (unsigned i = 0; i < 64; i++) {
+    budget.record(false, 0);
+  }
+  ASS_EQ(budget.limit(),0u);
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+#include "Test/SyntaxSugar.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Shell/SineUtils.hpp"
+
+using namespace Shell;
+
+namespace {
+
+Stack<Unit*> select(UnitList* units, float tolerance, unsigned depth, unsigned genThreshold, SineIndex* index)
+{
+  UnitList* res = UnitList::copy(units);
+  SineSelector(/* onIncluded */ false, tolerance, depth, genThreshold).perform(res, index);
+  auto out = iterTraits(UnitList::Iterator(res)).collect<Stack>();
+  UnitList::destroy(res);
+  return out;
+}
+
+void checkSameSelection(UnitList* units, SineIndex& index)
+{
+  for (float tolerance : { 1.0f, 1.5f, 3.0f, -1.0f }) {
+    for (unsigned depth : { 0u, 1u, 2u }) {
+      for (unsigned genThreshold : { 0u, 2u }) {
+        Stack<Unit*> expected = select(units, tolerance, depth, genThreshold, nullptr);
+        Stack<Unit*> withIndex = select(units, tolerance, depth, genThreshold, &index);
+        if (expected != withIndex) {
+          std::cout << "[ FAIL ] tolerance " << tolerance << ", depth " << depth << ", threshold " << genThreshold << std::endl;
+          std::cout << "[  exp ] " << expected << std::endl;
+          std::cout << "[   is ] " << withIndex << std::endl;
+          ASSERTION_VIOLATION
+        }
+      }
+    }
+  }
+}
+
+}
+
+/**
+ * The index shared by the portfolio slices must select the same units,
+ * in the same order, as a selection computing the D-relation from scratch.
+ */
+TEST_FUN(index_selects_like_selector) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_CONST(b, s)
+  DECL_CONST(c, s)
+  DECL_PRED(p, {s})
+  DECL_PRED(q, {s})
+  DECL_PRED(r, {s})
+  DECL_PRED(t, {s})
+  DECL_PRED(u, {s, s})
+
+  Stack<Clause*> axioms = clauses({
+      { p(x), ~q(x) },
+      { q(b), r(b) },
+      { r(c) },
+      { q(a), u(a, b) },
+      { ~u(x, y), t(y) },
+      { t(c), p(c) },
+      { u(c, c) },
+  });
+  Clause* goal = clause({ ~p(a) });
+  goal->setInputType(UnitInputType::NEGATED_CONJECTURE);
+
+  UnitList* units = nullptr;
+  UnitList::push(goal, units);
+  for (Clause* ax : axioms) {
+    ax->setInputType(UnitInputType::AXIOM);
+    UnitList::push(ax, units);
+  }
+
+  SineIndex index;
+  checkSameSelection(units, index);
+
+  // the index follows changes of the unit set, as between the slices
+  // (the goal is at the end of units)
+  UnitList* fewer = UnitList::copy(units->tail()->tail());
+  checkSameSelection(fewer, index);
+  checkSameSelection(units, index);
+
+  UnitList::destroy(fewer);
+  UnitList::destroy(units);
+}
@@ -13,6 +13,10 @@
 #include "Test/SyntaxSugar.hpp"
 #include "Indexing/TermSubstitutionTree.hpp"
 #include "Indexing/LiteralSubstitutionTree.hpp"
+#include "Indexing/LiteralIndex.hpp"
+#include "Lib/Environment.hpp"
+#include "Saturation/ClauseContainer.hpp"
+#include "Shell/Statistics.hpp"
 
 
 using namespace Test;
@@ -299,3 +303,59 @@ TEST_FUN(zero_arity_predicate) {
 
 }
 
+
+TEST_FUN(retain_frozen_clauses) {
+  DECL_DEFAULT_VARS
+  DECL_SORT(s)
+  DECL_CONST(a, s)
+  DECL_PRED(p, {s})
+
+  Saturation::ActiveClauseContainer active;
+  BinaryResolutionIndex index(new LiteralSubstitutionTree<LiteralClause>());
+  index.retainFrozen();
+  index.attachContainer(&active);
+
+  Clause* c = clause({ p(x) });
+  c->setSelected(1);
+  c->incRefCnt();
+  auto unifications = [&]() { return iterTraits(index.getUnifications(p(a), /* complementary */ false)).count(); };
+  unsigned avoided = env.statistics->satSplitReinsertionsAvoided;
+
+  c->setStore(Clause::ACTIVE);
+  active.add(c);
+  ASS_EQ(unifications(), 1u);
+
+  // a frozen clause stays in the index, but is not retrieved
+  active.freeze(c, 1);
+  c->setStore(Clause::NONE);
+  ASS(c->isFrozen());
+  ASS_EQ(unifications(), 0u);
+  ASS_EQ(iterTraits(index.getAll()).count(), 0u);
+  ASS_EQ(index.getUnificationCount(p(a), false), 0u);
+
+  // adding it back does not insert it a second time
+  c->setStore(Clause::ACTIVE);
+  active.add(c);
+  ASS(!c->isFrozen());
+  ASS_EQ(unifications(), 1u);
+  ASS_EQ(env.statistics->satSplitReinsertionsAvoided, avoided + 1);
+
+  // the entry of an earlier freeze does not drop a clause frozen again
+  active.freeze(c, 2);
+  c->setStore(Clause::NONE);
+  active.dropFrozenBefore(2);
+  ASS(c->isFrozen());
+
+  // dropping takes it out of the index for good
+  active.dropFrozenBefore(3);
+  ASS(!c->isFrozen());
+  c->setStore(Clause::ACTIVE);
+  active.add(c);
+  ASS_EQ(unifications(), 1u);
+  ASS_EQ(env.statistics->satSplitReinsertionsAvoided, avoided + 1);
+
+  active.remove(c);
+  ASS_EQ(unifications(), 0u);
+  c->setStore(Clause::NONE);
+  c->decRefCnt();
+}
@@ -0,0 +1,49 @@
+/*
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Test/UnitTesting.hpp"
+
+#include "Kernel/Problem.hpp"
+#include "Kernel/Unit.hpp"
+#include "Lib/Environment.hpp"
+#include "Shell/Options.hpp"
+#include "Shell/UIHelper.hpp"
+
+using namespace Kernel;
+using namespace Shell;
+
+/**
+ * The server metamode extends a copy of the axiom base by the units of
+ * the piece loaded on top of it (see UIHelper::getInputProblemOver).
+ */
+TEST_FUN(input_problem_over_base) {
+  UIHelper::parseSingleLine("fof(ax1,axiom,p(a)).", Options::InputSyntax::TPTP);
+  UIHelper::parseSingleLine("fof(ax2,axiom,q(a)).", Options::InputSyntax::TPTP);
+
+  Problem* base = UIHelper::getInputProblem();
+  base->units() = UnitList::copy(base->units());
+  ASS_EQ(UnitList::length(base->units()), 2);
+
+  UIHelper::parseSingleLine("fof(goal,conjecture,p(a) & q(a)).", Options::InputSyntax::TPTP);
+  Problem* prb = UIHelper::getInputProblemOver(base);
+
+  ASS_EQ(UnitList::length(prb->units()), 3);
+  unsigned conjectures = 0;
+  for (auto it = UnitList::Iterator(prb->units()); it.hasNext(); ) {
+    if (it.next()->inputType() == UnitInputType::CONJECTURE) {
+      conjectures++;
+    }
+  }
+  ASS_EQ(conjectures, 1u);
+
+  UIHelper::popLoadedPiece(3);
+  env.setMainProblem(nullptr);
+  delete prb;
+}
@@ -14,6 +14,7 @@
 #include "Lib/Environment.hpp"
 
 #include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
 #include "Test/TestUtils.hpp"
 
 #include "Kernel/Unit.hpp"
@@ -1230,6 +1231,59 @@ ROB_UNIFY_TEST(rob_unif_test_06,
     })
 
 
+/**
+ * Abstractions of ground term pairs are cached per oracle mode. A cached answer
+ * must be the one computed from scratch, and must not be given to another mode.
+ */
+TEST_FUN(abstraction_cache_ground_pairs)
+{
+  SUGAR(Rat)
+  // constants of our own, so no other test has abstracted these terms yet
+  DECL_CONST(d, Rat)
+  DECL_CONST(e, Rat)
+
+  auto oneInterp = Options::UnificationWithAbstraction::ONE_INTERP;
+  auto interpOnly = Options::UnificationWithAbstraction::INTERP_ONLY;
+  auto hits = []() { return env.statistics->uwaAbstractionCacheHits; };
+  auto exp = TermUnificationResultSpec {
+      .querySigma = f(d + 1),
+      .resultSigma = f(e),
+      .constraints = { d + 1 != e },
+  };
+
+  unsigned before = hits();
+  auto fresh = runRobUnify(/* namespaced */ false, oneInterp, /* fixedPointIteration */ false, f(d + 1), f(e));
+  ASS_EQ(hits(), before);
+  ASS(fresh.isSome());
+  ASS_EQ(fresh.unwrap(), exp);
+
+  before = hits();
+  auto cached = runRobUnify(/* namespaced */ false, oneInterp, /* fixedPointIteration */ false, f(d + 1), f(e));
+  ASS_G(hits(), before);
+  ASS(cached.isSome());
+  ASS_EQ(cached.unwrap(), exp);
+
+  // e is not interpreted, so interp_only cannot abstract, neither fresh ...
+  before = hits();
+  auto other = runRobUnify(/* namespaced */ false, interpOnly, /* fixedPointIteration */ false, f(d + 1), f(e));
+  ASS_EQ(hits(), before);
+  ASS(other.isNone());
+
+  // ... nor cached
+  before = hits();
+  other = runRobUnify(/* namespaced */ false, interpOnly, /* fixedPointIteration */ false, f(d + 1), f(e));
+  ASS_G(hits(), before);
+  ASS(other.isNone());
+
+  // and its entries leave the ones of one_interp intact
+  before = hits();
+  auto again = runRobUnify(/* namespaced */ false, oneInterp, /* fixedPointIteration */ false, f(d + 1), f(e));
+  ASS_G(hits(), before);
+  ASS(again.isSome());
+  ASS_EQ(again.unwrap(), exp);
+}
+
+
 
 ROB_UNIFY_TEST(alasca3_test_01,
     SUGAR(Rat),
@@ -328,10 +328,13 @@ void outputMode(Problem* problem)
   UIHelper::outputSymbolDeclarations(std::cout);
   UnitList::Iterator units(prb->units());
 
+  TPTPWriter out(std::cout);
   while (units.hasNext()) {
     Unit* u = units.next();
-    std::cout << TPTPPrinter::toString(u) << "\n";
+    out.write(u);
+    out.write("\n");
   }
+  out.flush();
 
   if(env.options->latexOutput()!="off"){ outputProblemToLaTeX(prb.ptr()); }
 
@@ -455,6 +458,7 @@ void clausifyMode(Problem* problem, bool theory)
   //UIHelper::outputSortDeclarations(std::cout);
   UIHelper::outputSymbolDeclarations(std::cout);
 
+  TPTPWriter out(std::cout);
   ClauseIterator cit = prb->clauseIterator();
   bool printed_conjecture = false;
   while (cit.hasNext()) {
@@ -474,10 +478,11 @@ void clausifyMode(Problem* problem, bool theory)
 
       FormulaUnit* fu = new FormulaUnit(f,cl->inference()); // we are stealing cl's inference, which is not nice!
       fu->overwriteNumber(cl->number()); // we are also making sure it's number is the same as that of the original (for Kostya from Russia to CASC, with love, and back again)
-      std::cout << TPTPPrinter::toString(fu) << "\n";
+      out.write(fu);
     } else {
-      std::cout << TPTPPrinter::toString(cl) << "\n";
+      out.write(cl);
     }
+    out.write("\n");
   }
   if(!printed_conjecture && UIHelper::haveConjecture()){
     unsigned p = env.signature->addFreshPredicate(0,"p");
@@ -486,8 +491,10 @@ void clausifyMode(Problem* problem, bool theory)
         Literal::create(p, /* polarity */ false, {})
       }, 
       NonspecificInference0(UnitInputType::NEGATED_CONJECTURE,InferenceRule::INPUT));
-    std::cout << TPTPPrinter::toString(c) << "\n";
+    out.write(c);
+    out.write("\n");
   }
+  out.flush();
 
   if (env.options->latexOutput() != "off") { outputClausesToLaTeX(prb.ptr()); }
 
@@ -710,6 +717,78 @@ void interactiveMetamode()
   }
 }
 
+/**
+ * Server metamode for LTB-style workloads: many conjectures over one large axiom base.
+ *
+ * The input file is parsed once as the axiom base, its Property computed and
+ * (unless sine_shared_index is off) a SInE index over it built. Each line then read from cin,
+ * of the form '[options] <conjecture file>', is solved by a child forked from this warm state
+ * (which dispatches by mode as usual, e.g. to a portfolio). The children are run one at a time
+ * and the end of each is reported by a line '% done <conjecture file> <exit status>'.
+ */
+void serverMetamode()
+{
+  Options& opts = *env.options;
+  opts.setServer(false); // so that we don't pass the server role on to the workers
+
+  if (opts.inputFile().empty()) {
+    USER_ERROR("The server mode needs the axiom base as its input file");
+  }
+  UIHelper::parseFile(opts.inputFile(),opts.inputSyntax(),true);
+  opts.resetInputFile();
+
+  // the base's own copy of the unit list, so that pieces loaded on top of it don't extend it behind its back
+  ScopedPtr<Problem> base(UIHelper::getInputProblem());
+  base->units() = UnitList::copy(base->units());
+  base->getProperty();
+
+  // the SInE index over the base, which the selections in the children only extend by the conjecture
+  SineIndex sineIndex;
+  if (opts.sineSharedIndex()) {
+    sineIndex.sync(base->units());
+    sineIndex.sortAll();
+    base->setSineIndex(&sineIndex);
+  }
+
+  std::string line;
+  while (getline(cin, line)) {
+    Stack<std::string> pieces;
+    StringUtils::splitStr(line.c_str(),' ',pieces);
+    StringUtils::dropEmpty(pieces);
+    if (pieces.isEmpty()) {
+      continue;
+    }
+    if (pieces[0] == "exit") {
+      break;
+    }
+
+    pid_t process = Lib::Sys::Multiprocessing::instance()->fork();
+    ASS_NEQ(process, -1);
+    if (process == 0) {
+      Timer::reinitialise(); // start our timer (in the child)
+
+      Stack<const char*> argv(pieces.size()+1);
+      argv.push("server");
+      for (auto it = pieces.iterFifo(); it.hasNext();) {
+        argv.push(it.next().c_str());
+      }
+      Shell::CommandLine cl(argv.size(), argv.begin());
+      cl.interpret(opts);
+      if (opts.inputFile().empty()) {
+        USER_ERROR("No conjecture file given in: "+line);
+      }
+      UIHelper::parseFile(opts.inputFile(),opts.inputSyntax(),false);
+
+      dispatchByMode(UIHelper::getInputProblemOver(base.release()));
+      exit(vampireReturnValue);
+    }
+
+    int status;
+    Lib::Sys::Multiprocessing::instance()->waitForChildTermination(status);
+    cout << "% done " << pieces.top() << " " << status << endl;
+  }
+}
+
 /**
  * The main function.
  * @since 03/12/2003 many changes related to logging
@@ -754,6 +833,8 @@ int main(int argc, char* argv[])
 
     if (opts.interactive()) {
       interactiveMetamode();
+    } else if (opts.server()) {
+      serverMetamode();
     } else {
       // can only happen after reading options as it relies on `env.options`
       Timer::reinitialise(); // start our timer, so that we also limit parsing